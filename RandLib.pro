@@ -69,9 +69,12 @@ SOURCES += \
     distributions/univariate/discrete/CategoricalRand.cpp \
     distributions/univariate/continuous/NoncentralChiSquaredRand.cpp \
     distributions/univariate/continuous/KolmogorovSmirnovRand.cpp \
+    distributions/univariate/continuous/NumericalInversion.cpp \
+    distributions/univariate/continuous/TransformedDensityRejection.cpp \
     math/BetaMath.cpp \
     math/GammaMath.cpp \
     math/NumericMath.cpp \
+    math/VectorMath.cpp \
     distributions/univariate/continuous/MarchenkoPasturRand.cpp \
     distributions/bivariate/ContinuousBivariateDistribution.cpp \
     distributions/bivariate/DiscreteBivariateDistribution.cpp \
@@ -143,9 +146,12 @@ HEADERS +=\
     distributions/univariate/discrete/CategoricalRand.h \
     distributions/univariate/continuous/NoncentralChiSquaredRand.h \
     distributions/univariate/continuous/KolmogorovSmirnovRand.h \
+    distributions/univariate/continuous/NumericalInversion.h \
+    distributions/univariate/continuous/TransformedDensityRejection.h \
     math/BetaMath.h \
     math/GammaMath.h \
     math/NumericMath.h \
+    math/VectorMath.h \
     RandLib_global.h \
     distributions/univariate/continuous/MarchenkoPasturRand.h \
     distributions/bivariate/ContinuousBivariateDistribution.h \
@@ -32,6 +32,8 @@
 #include "univariate/continuous/NakagamiRand.h"
 #include "univariate/continuous/NoncentralChiSquaredRand.h"
 #include "univariate/continuous/NormalRand.h"
+#include "univariate/continuous/NumericalInversion.h"
+#include "univariate/continuous/TransformedDensityRejection.h"
 #include "univariate/continuous/ParetoRand.h"
 #include "univariate/continuous/PlanckRand.h"
 #include "univariate/continuous/RaisedCosineRand.h"
@@ -1,10 +1,21 @@
 #include "ProbabilityDistribution.h"
 #include <sstream>
 #include <iomanip>
+#include <pthread.h>
 
 template < typename T >
 thread_local RandGenerator ProbabilityDistribution<T>::staticRandGenerator;
 
+template < typename T >
+void ProbabilityDistribution<T>::reseedAfterFork()
+{
+    /// new generator takes seed, which depends on process id
+    staticRandGenerator.SetEngine(staticRandGenerator);
+}
+
+template < typename T >
+const bool ProbabilityDistribution<T>::forkHandlerIsSet = (pthread_atfork(nullptr, nullptr, ProbabilityDistribution<T>::reseedAfterFork) == 0);
+
 template < typename T >
 ProbabilityDistribution<T>::ProbabilityDistribution()
 {
@@ -57,6 +68,24 @@ void ProbabilityDistribution<T>::Reseed(unsigned long seed) const
     localRandGenerator.Reseed(seed);
 }
 
+template < typename T >
+void ProbabilityDistribution<T>::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+}
+
+template < typename T >
+void ProbabilityDistribution<T>::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+}
+
+template < typename T >
+void ProbabilityDistribution<T>::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+}
+
 template < typename T >
 constexpr char ProbabilityDistribution<T>::POSITIVITY_VIOLATION[];
 template < typename T >
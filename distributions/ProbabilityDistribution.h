@@ -17,6 +17,17 @@ class RANDLIBSHARED_EXPORT ProbabilityDistribution
 protected:
     static thread_local RandGenerator staticRandGenerator;
 
+    /**
+     * @fn reseedAfterFork
+     * child process reseeds static generator of the forking thread,
+     * otherwise it repeats the stream of its parent.
+     * Only this generator is covered: local generators of distributions, as well as RandGenerator objects of the user,
+     * are copied to the child with the state of the parent. Child should reseed them itself,
+     * e.g. by Reseed() with its own seed or by SetEngine(), which takes new seed, depending on process id
+     */
+    static void reseedAfterFork();
+    static const bool forkHandlerIsSet;
+
     mutable RandGenerator localRandGenerator{};
 
     /**
@@ -97,6 +108,30 @@ public:
      */
     virtual void Reseed(unsigned long seed) const;
 
+    /**
+     * @fn SetEngine
+     * switch all generators of the distribution to new randomly seeded engines
+     * of the same type as in prototype, for instance RandGenerator(SFC64RandEngine());
+     * forked child should call it for distributions created by the parent, so that it doesn't repeat parent's variates
+     * @param prototype
+     */
+    virtual void SetEngine(const RandGenerator &prototype) const;
+
+    /**
+     * @fn SaveState
+     * write binary state of all generators of the distribution,
+     * so that sampling can be resumed by LoadState
+     * @param outputStream
+     */
+    virtual void SaveState(std::ostream &outputStream) const;
+
+    /**
+     * @fn LoadState
+     * read binary state, written by SaveState of the same distribution
+     * @param inputStream
+     */
+    virtual void LoadState(std::istream &inputStream) const;
+
 protected:
     enum FIT_ERROR_TYPE {
         WRONG_SAMPLE,
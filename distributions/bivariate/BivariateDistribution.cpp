@@ -12,6 +12,30 @@ void BivariateDistribution<T1, T2, T>::Reseed(unsigned long seed) const
     Y.Reseed(seed + 2);
 }
 
+template < class T1, class T2, typename T >
+void BivariateDistribution<T1, T2, T>::SetEngine(const RandGenerator &prototype) const
+{
+    this->localRandGenerator.SetEngine(prototype);
+    X.SetEngine(prototype);
+    Y.SetEngine(prototype);
+}
+
+template < class T1, class T2, typename T >
+void BivariateDistribution<T1, T2, T>::SaveState(std::ostream &outputStream) const
+{
+    this->localRandGenerator.SaveState(outputStream);
+    X.SaveState(outputStream);
+    Y.SaveState(outputStream);
+}
+
+template < class T1, class T2, typename T >
+void BivariateDistribution<T1, T2, T>::LoadState(std::istream &inputStream) const
+{
+    this->localRandGenerator.LoadState(inputStream);
+    X.LoadState(inputStream);
+    Y.LoadState(inputStream);
+}
+
 template < class T1, class T2, typename T >
 DoublePair BivariateDistribution<T1, T2, T>::Mean() const
 {
@@ -22,6 +22,9 @@ public:
     T MaxValue() const { return T(X.MaxValue(), Y.MaxValue()); }
 
     void Reseed(unsigned long seed) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
+    void SaveState(std::ostream &outputStream) const override;
+    void LoadState(std::istream &inputStream) const override;
 
     virtual DoublePair Mean() const final;
     virtual DoubleTriplet Covariance() const final;
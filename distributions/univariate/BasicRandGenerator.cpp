@@ -5,6 +5,12 @@
 #include <time.h>
 #include <iostream>
 #include <thread>
+#include <algorithm>
+#include "math/VectorMath.h"
+
+#ifdef RANDLIB_X86_SIMD
+#include <immintrin.h>
+#endif
 
 unsigned long RandEngine::mix(unsigned long a, unsigned long b, unsigned long c)
 {
@@ -23,71 +29,786 @@ unsigned long RandEngine::mix(unsigned long a, unsigned long b, unsigned long c)
 unsigned long RandEngine::getRandomSeed()
 {
     static thread_local unsigned long dummy = 123456789;
-    return mix(time(0), std::hash<std::thread::id>()(std::this_thread::get_id()), ++dummy);
+    unsigned long seed = mix(time(0), std::hash<std::thread::id>()(std::this_thread::get_id()), ++dummy);
+    /// forked processes share time, thread id and counter, therefore mix in process id
+    return mix(seed, getpid(), dummy);
+}
+
+unsigned long long RandEngine::splitMix64(unsigned long long &x)
+{
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+unsigned long long RandEngine::streamSeed(unsigned long long rootSeed, unsigned long long streamId)
+{
+    /// SplitMix64 output is a bijection of its state, hence different ids give different seeds
+    return rootSeed ^ splitMix64(streamId);
+}
+
+void RandEngine::seedLanes(unsigned long long *state, size_t lanes, unsigned long long seed)
+{
+    unsigned long long x = seed;
+    for (size_t l = 0; l != lanes; ++l) {
+        for (size_t j = 0; j != 4; ++j)
+            state[j * lanes + l] = splitMix64(x);
+    }
+}
+
+namespace
+{
+
+/// Scalar xoshiro256** lanes
+void stepLanesScalar(unsigned long long *state, size_t lanes, unsigned long long *output, size_t steps)
+{
+    for (size_t l = 0; l != lanes; ++l) {
+        unsigned long long s0 = state[l], s1 = state[lanes + l];
+        unsigned long long s2 = state[2 * lanes + l], s3 = state[3 * lanes + l];
+        for (size_t t = 0; t != steps; ++t) {
+            unsigned long long x = s1 * 5;
+            output[t * lanes + l] = ((x << 7) | (x >> 57)) * 9;
+            unsigned long long s1Shifted = s1 << 17;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= s1Shifted;
+            s3 = (s3 << 45) | (s3 >> 19);
+        }
+        state[l] = s0;
+        state[lanes + l] = s1;
+        state[2 * lanes + l] = s2;
+        state[3 * lanes + l] = s3;
+    }
+}
+
+#ifdef RANDLIB_X86_SIMD
+/// xoshiro256** in groups of 4 lanes, multiplications by 5 and 9 are made by shifts
+__attribute__((target("avx2")))
+void stepLanesAVX2(unsigned long long *state, size_t lanes, unsigned long long *output, size_t steps)
+{
+    for (size_t l = 0; l != lanes; l += 4) {
+        __m256i *s = reinterpret_cast<__m256i *>(state + l);
+        __m256i s0 = _mm256_loadu_si256(s), s1 = _mm256_loadu_si256(s + lanes / 4);
+        __m256i s2 = _mm256_loadu_si256(s + lanes / 2), s3 = _mm256_loadu_si256(s + 3 * lanes / 4);
+        for (size_t t = 0; t != steps; ++t) {
+            __m256i x = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+            x = _mm256_or_si256(_mm256_slli_epi64(x, 7), _mm256_srli_epi64(x, 57));
+            x = _mm256_add_epi64(_mm256_slli_epi64(x, 3), x);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + t * lanes + l), x);
+            __m256i s1Shifted = _mm256_slli_epi64(s1, 17);
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, s1Shifted);
+            s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+        }
+        _mm256_storeu_si256(s, s0);
+        _mm256_storeu_si256(s + lanes / 4, s1);
+        _mm256_storeu_si256(s + lanes / 2, s2);
+        _mm256_storeu_si256(s + 3 * lanes / 4, s3);
+    }
+}
+
+/// xoshiro256** in groups of 8 lanes, zero-masked forms of intrinsics avoid false warnings of GCC
+__attribute__((target("avx512f")))
+void stepLanesAVX512(unsigned long long *state, size_t lanes, unsigned long long *output, size_t steps)
+{
+    for (size_t l = 0; l != lanes; l += 8) {
+        unsigned long long *s = state + l;
+        __m512i s0 = _mm512_loadu_si512(s), s1 = _mm512_loadu_si512(s + lanes);
+        __m512i s2 = _mm512_loadu_si512(s + 2 * lanes), s3 = _mm512_loadu_si512(s + 3 * lanes);
+        for (size_t t = 0; t != steps; ++t) {
+            __m512i x = _mm512_add_epi64(_mm512_maskz_slli_epi64(0xFF, s1, 2), s1);
+            x = _mm512_maskz_rol_epi64(0xFF, x, 7);
+            x = _mm512_add_epi64(_mm512_maskz_slli_epi64(0xFF, x, 3), x);
+            _mm512_storeu_si512(output + t * lanes + l, x);
+            __m512i s1Shifted = _mm512_maskz_slli_epi64(0xFF, s1, 17);
+            s2 = _mm512_xor_si512(s2, s0);
+            s3 = _mm512_xor_si512(s3, s1);
+            s1 = _mm512_xor_si512(s1, s2);
+            s0 = _mm512_xor_si512(s0, s3);
+            s2 = _mm512_xor_si512(s2, s1Shifted);
+            s3 = _mm512_maskz_rol_epi64(0xFF, s3, 45);
+        }
+        _mm512_storeu_si512(s, s0);
+        _mm512_storeu_si512(s + lanes, s1);
+        _mm512_storeu_si512(s + 2 * lanes, s2);
+        _mm512_storeu_si512(s + 3 * lanes, s3);
+    }
+}
+#endif
+
+}
+
+void RandEngine::stepLanes(unsigned long long *state, size_t lanes, unsigned long long *output, size_t steps)
+{
+    if (steps == 0)
+        return;
+#ifdef RANDLIB_X86_SIMD
+    static const RandMath::SIMD_LEVEL level = RandMath::getSIMDLevel();
+    if (level == RandMath::AVX512 && lanes % 8 == 0)
+        return stepLanesAVX512(state, lanes, output, steps);
+    if (level >= RandMath::AVX2)
+        return stepLanesAVX2(state, lanes, output, steps);
+#endif
+    stepLanesScalar(state, lanes, output, steps);
+}
+
+namespace
+{
+
+#ifdef RANDLIB_X86_SIMD
+/**
+ * @brief The ConversionSetup struct
+ * every conversion is (k + offset) * scale or (k + offset) / scale for k = word >> shift,
+ * which has at most 53 bits
+ */
+struct ConversionSetup
+{
+    int shift;
+    bool wide; ///< true if k has 53 bits
+    double offset;
+    double scale;
+    bool divide;
+};
+
+ConversionSetup setupConversion(int shift32, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+{
+    if (resolution == RESOLUTION_32) {
+        if (interval == OPEN_INTERVAL)
+            return {shift32, false, 0.5, 2.3283064365386963e-10, false};
+        if (interval == HALF_OPEN_INTERVAL)
+            return {shift32, false, 0.0, 2.3283064365386963e-10, false};
+        return {shift32, false, 0.0, 4294967295.0, true};
+    }
+    if (interval == OPEN_INTERVAL)
+        return {12, false, 0.5, 2.220446049250313e-16, false};
+    if (interval == HALF_OPEN_INTERVAL)
+        return {11, true, 0.0, 1.1102230246251565e-16, false};
+    return {11, true, 0.0, 9007199254740991.0, true};
+}
+
+/// integers below 2^52 become doubles by adding exponent of 2^52, wider ones are halved first
+__attribute__((target("avx2")))
+size_t fromWordsAVX2(const unsigned long long *words, double *output, size_t size, const ConversionSetup &setup)
+{
+    const __m128i shift = _mm_cvtsi32_si128(setup.shift);
+    const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000LL), one = _mm256_set1_epi64x(1);
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0);
+    const __m256d offset = _mm256_set1_pd(setup.offset), scale = _mm256_set1_pd(setup.scale);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256i k = _mm256_srl_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + i)), shift);
+        __m256d x;
+        if (setup.wide) {
+            __m256d half = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(k, 1), magicBits)), magic);
+            __m256d lowest = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(k, one), magicBits)), magic);
+            x = _mm256_add_pd(_mm256_add_pd(half, half), lowest);
+        }
+        else {
+            x = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(k, magicBits)), magic);
+        }
+        x = _mm256_add_pd(x, offset);
+        x = setup.divide ? _mm256_div_pd(x, scale) : _mm256_mul_pd(x, scale);
+        _mm256_storeu_pd(output + i, x);
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+size_t fromWordsAVX512(const unsigned long long *words, double *output, size_t size, const ConversionSetup &setup)
+{
+    const __m128i shift = _mm_cvtsi32_si128(setup.shift);
+    const __m512i magicBits = _mm512_set1_epi64(0x4330000000000000LL), one = _mm512_set1_epi64(1);
+    const __m512d magic = _mm512_set1_pd(4503599627370496.0);
+    const __m512d offset = _mm512_set1_pd(setup.offset), scale = _mm512_set1_pd(setup.scale);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m512i k = _mm512_maskz_srl_epi64(0xFF, _mm512_loadu_si512(words + i), shift);
+        __m512d x;
+        if (setup.wide) {
+            __m512d half = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_maskz_srli_epi64(0xFF, k, 1), magicBits)), magic);
+            __m512d lowest = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(k, one), magicBits)), magic);
+            x = _mm512_add_pd(_mm512_add_pd(half, half), lowest);
+        }
+        else {
+            x = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(k, magicBits)), magic);
+        }
+        x = _mm512_add_pd(x, offset);
+        x = setup.divide ? _mm512_div_pd(x, scale) : _mm512_mul_pd(x, scale);
+        _mm512_storeu_pd(output + i, x);
+    }
+    return i;
+}
+#endif
+
+}
+
+void UniformConversion::FromWords(const unsigned long long *words, double *output, size_t size, int shift32,
+                                  UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+{
+    size_t i = 0;
+#ifdef RANDLIB_X86_SIMD
+    static const RandMath::SIMD_LEVEL level = RandMath::getSIMDLevel();
+    ConversionSetup setup = setupConversion(shift32, interval, resolution);
+    if (level == RandMath::AVX512)
+        i = fromWordsAVX512(words, output, size, setup);
+    else if (level == RandMath::AVX2)
+        i = fromWordsAVX2(words, output, size, setup);
+#endif
+    for (; i != size; ++i)
+        output[i] = FromWord(words[i], shift32, interval, resolution);
+}
+
+namespace
+{
+
+/**
+ * @fn advanceLCG
+ * @param x state of LCG x -> mult * x + inc modulo 2^w
+ * @return state after n * 2^k steps
+ */
+template <typename UIntType>
+UIntType advanceLCG(UIntType x, UIntType mult, UIntType inc, unsigned long long n, unsigned int k)
+{
+    /// Brown's algorithm: square the transformation and apply it for every bit of n
+    for (unsigned int i = 0; i != k; ++i) {
+        inc *= mult + 1;
+        mult *= mult;
+    }
+    for (; n != 0; n >>= 1) {
+        if (n & 1)
+            x = mult * x + inc;
+        inc *= mult + 1;
+        mult *= mult;
+    }
+    return x;
+}
+
+/**
+ * @fn advanceXorshift
+ * @param y state of xorshift generator, which is a linear map over GF(2)
+ * @param step one step of the generator
+ * @return state after n * 2^k steps
+ */
+template <typename UIntType, class Step>
+UIntType advanceXorshift(UIntType y, Step step, unsigned long long n, unsigned int k)
+{
+    static constexpr size_t N = 8 * sizeof(UIntType);
+    /// matrix of the step, j-th column is the image of j-th unit vector
+    UIntType matrix[N], square[N];
+    for (size_t j = 0; j != N; ++j)
+        matrix[j] = step(static_cast<UIntType>(1) << j);
+    auto apply = [&matrix] (UIntType v) {
+        UIntType result = 0;
+        for (size_t j = 0; v != 0; ++j, v >>= 1) {
+            if (v & 1)
+                result ^= matrix[j];
+        }
+        return result;
+    };
+    auto squareMatrix = [&] () {
+        for (size_t j = 0; j != N; ++j)
+            square[j] = apply(matrix[j]);
+        std::copy(square, square + N, matrix);
+    };
+    for (unsigned int i = 0; i != k; ++i)
+        squareMatrix();
+    for (; n != 0; n >>= 1) {
+        if (n & 1)
+            y = apply(y);
+        if (n > 1)
+            squareMatrix();
+    }
+    return y;
+}
+
+/**
+ * @fn mulMod
+ * @return a * b mod m without overflow for any m < 2^64
+ */
+unsigned long long mulMod(unsigned long long a, unsigned long long b, unsigned long long m)
+{
+    auto addMod = [m] (unsigned long long x, unsigned long long y) {
+        return (x >= m - y) ? x - (m - y) : x + y;
+    };
+    unsigned long long result = 0;
+    for (a %= m; b != 0; b >>= 1) {
+        if (b & 1)
+            result = addMod(result, a);
+        a = addMod(a, a);
+    }
+    return result;
+}
+
+/**
+ * @fn advanceMWC
+ * lag-1 multiply-with-carry generator with base 2^32 and multiplier a is equivalent to
+ * LCG u -> a * u mod (a * 2^32 - 1) for u = C * 2^32 + Z,
+ * so we move Z and C on n * 2^k steps ahead via this LCG
+ */
+void advanceMWC(unsigned int &Z, unsigned int &C, unsigned long long a, unsigned long long n, unsigned int k)
+{
+    unsigned long long m = (a << 32) - 1;
+    unsigned long long mult = a, u = (static_cast<unsigned long long>(C) << 32) | Z;
+    for (unsigned int i = 0; i != k; ++i)
+        mult = mulMod(mult, mult, m);
+    for (; n != 0; n >>= 1) {
+        if (n & 1)
+            u = mulMod(mult, u, m);
+        mult = mulMod(mult, mult, m);
+    }
+    Z = u;
+    C = u >> 32;
+}
+
+unsigned int xorshift32(unsigned int y)
+{
+    y ^= y << 13;
+    y ^= y >> 17;
+    y ^= y << 5;
+    return y;
+}
+
+unsigned long long xorshift64(unsigned long long y)
+{
+    y ^= y << 21;
+    y ^= y >> 17;
+    y ^= y << 30;
+    return y;
+}
+
+}
+
+void JKissRandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    unsigned long long x = streamSeed(rootSeed, streamId);
+    unsigned long long word = splitMix64(x);
+    X = word;
+    Y = word >> 32;
+    if (Y == 0) /// xorshift can't leave zero
+        Y = 987654321;
+    word = splitMix64(x);
+    Z = word;
+    /// 0 < C < a - 1 excludes both fixed points (0, 0) and (2^32 - 1, a - 1) of multiply-with-carry
+    C = (word >> 32) % 698769067ULL + 1;
+}
+
+void JKissRandEngine::Fill(unsigned long long *output, size_t size)
+{
+    /// keep the state in local variables for the whole block
+    unsigned int x = X, c = C, y = Y, z = Z;
+    for (size_t i = 0; i != size; ++i) {
+        unsigned long long t = 698769069ULL * z + c;
+        x = 69069 * x + 12345;
+        y ^= y << 13;
+        y ^= y >> 17;
+        y ^= y << 5;
+        c = t >> 32;
+        z = t;
+        output[i] = x + y + z;
+    }
+    X = x;
+    C = c;
+    Y = y;
+    Z = z;
+}
+
+void JKissRandEngine::Discard(unsigned long long n)
+{
+    X = advanceLCG<unsigned int>(X, 69069, 12345, n, 0);
+    Y = advanceXorshift(Y, xorshift32, n, 0);
+    advanceMWC(Z, C, 698769069ULL, n, 0);
+}
+
+void JKissRandEngine::Jump(unsigned int k)
+{
+    X = advanceLCG<unsigned int>(X, 69069, 12345, 1, k);
+    Y = advanceXorshift(Y, xorshift32, 1, k);
+    advanceMWC(Z, C, 698769069ULL, 1, k);
+}
+
+void JLKiss64RandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    unsigned long long x = streamSeed(rootSeed, streamId);
+    X = splitMix64(x);
+    Y = splitMix64(x);
+    if (Y == 0) /// xorshift can't leave zero
+        Y = 987654321987ULL;
+    /// 0 < C < a - 1 excludes both fixed points (0, 0) and (2^32 - 1, a - 1) of multiply-with-carry
+    unsigned long long word = splitMix64(x);
+    Z1 = word;
+    C1 = (word >> 32) % 4294584391ULL + 1;
+    word = splitMix64(x);
+    Z2 = word;
+    C2 = (word >> 32) % 4246477507ULL + 1;
+}
+
+void JLKiss64RandEngine::Fill(unsigned long long *output, size_t size)
+{
+    /// keep the state in local variables for the whole block
+    unsigned long long x = X, y = Y;
+    unsigned int z1 = Z1, z2 = Z2, c1 = C1, c2 = C2;
+    for (size_t i = 0; i != size; ++i) {
+        x = 1490024343005336237ULL * x + 123456789;
+        y ^= y << 21;
+        y ^= y >> 17;
+        y ^= y << 30;
+        unsigned long long t = 4294584393ULL * z1 + c1;
+        c1 = t >> 32;
+        z1 = t;
+        t = 4246477509ULL * z2 + c2;
+        c2 = t >> 32;
+        z2 = t;
+        output[i] = x + y + z1 + (static_cast<unsigned long long>(z2) << 32);
+    }
+    X = x;
+    Y = y;
+    Z1 = z1;
+    Z2 = z2;
+    C1 = c1;
+    C2 = c2;
+}
+
+void JLKiss64RandEngine::Discard(unsigned long long n)
+{
+    X = advanceLCG<unsigned long long>(X, 1490024343005336237ULL, 123456789, n, 0);
+    Y = advanceXorshift(Y, xorshift64, n, 0);
+    advanceMWC(Z1, C1, 4294584393ULL, n, 0);
+    advanceMWC(Z2, C2, 4246477509ULL, n, 0);
+}
+
+void JLKiss64RandEngine::Jump(unsigned int k)
+{
+    X = advanceLCG<unsigned long long>(X, 1490024343005336237ULL, 123456789, 1, k);
+    Y = advanceXorshift(Y, xorshift64, 1, k);
+    advanceMWC(Z1, C1, 4294584393ULL, 1, k);
+    advanceMWC(Z2, C2, 4246477509ULL, 1, k);
+}
+
+void PCGRandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    /// different stream ids give different increments, i.e. different sequences
+    unsigned long long x = streamSeed(rootSeed, streamId);
+    inc = (streamId << 1) | 1;
+    state = 0;
+    Next();
+    state += splitMix64(x);
+    Next();
+}
+
+void PCGRandEngine::Fill(unsigned long long *output, size_t size)
+{
+    /// keep the state in local variables for the whole block
+    unsigned long long s = state, increment = inc | 1;
+    for (size_t i = 0; i != size; ++i) {
+        unsigned long long oldstate = s;
+        s = oldstate * 6364136223846793005ULL + increment;
+        unsigned int xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
+        unsigned int rot = oldstate >> 59u;
+        output[i] = (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    }
+    state = s;
+}
+
+void PCGRandEngine::Discard(unsigned long long n)
+{
+    state = advanceLCG<unsigned long long>(state, 6364136223846793005ULL, inc | 1, n, 0);
+}
+
+void PCGRandEngine::Jump(unsigned int k)
+{
+    state = advanceLCG<unsigned long long>(state, 6364136223846793005ULL, inc | 1, 1, k);
+}
+
+void PhiloxRandEngine::generateBlock(unsigned long long counter, unsigned long long *output) const
+{
+    static constexpr unsigned int M0 = 0xD2511F53, M1 = 0xCD9E8D57; /// multipliers
+    static constexpr unsigned int W0 = 0x9E3779B9, W1 = 0xBB67AE85; /// Weyl sequence for the key
+    unsigned int c0 = counter, c1 = counter >> 32, c2 = stream, c3 = stream >> 32;
+    unsigned int k0 = key[0], k1 = key[1];
+    for (int round = 0; round != 10; ++round) {
+        unsigned long long p0 = static_cast<unsigned long long>(M0) * c0;
+        unsigned long long p1 = static_cast<unsigned long long>(M1) * c2;
+        c0 = (p1 >> 32) ^ c1 ^ k0;
+        c1 = p1;
+        c2 = (p0 >> 32) ^ c3 ^ k1;
+        c3 = p0;
+        k0 += W0;
+        k1 += W1;
+    }
+    output[0] = c0 | (static_cast<unsigned long long>(c1) << 32);
+    output[1] = c2 | (static_cast<unsigned long long>(c3) << 32);
+}
+
+void PhiloxRandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    unsigned long long x = rootSeed;
+    unsigned long long word = splitMix64(x);
+    key[0] = word;
+    key[1] = word >> 32;
+    stream = streamId;
+    index = 0;
+}
+
+void PhiloxRandEngine::Fill(unsigned long long *output, size_t size)
+{
+    if (size == 0)
+        return;
+    /// finish current block
+    if (index & 1) {
+        *output++ = block[1];
+        ++index;
+        --size;
+    }
+    /// generate whole blocks directly into the output
+    for (; size >= 2; size -= 2, output += 2, index += 2)
+        generateBlock(index >> 1, output);
+    if (size > 0)
+        *output = Next();
+}
+
+void PhiloxRandEngine::Discard(unsigned long long n)
+{
+    index += n;
+    if (index & 1)
+        generateBlock(index >> 1, block);
+}
+
+void PhiloxRandEngine::Jump(unsigned int k)
+{
+    if (k < 64)
+        Discard(1ULL << k);
+}
+
+unsigned long long PhiloxRandEngine::Output(unsigned long long i) const
+{
+    unsigned long long words[2];
+    generateBlock(i >> 1, words);
+    return words[i & 1];
 }
 
-void JKissRandEngine::Reseed(unsigned long seed)
+void Xoshiro256RandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
 {
-    X = 123456789 ^ seed;
-    C = 6543217;
-    Y = 987654321;
-    Z = 43219876;
+    unsigned long long x = streamSeed(rootSeed, streamId);
+    for (unsigned long long & word : s)
+        word = splitMix64(x);
 }
 
-unsigned long long JKissRandEngine::Next()
+void Xoshiro256RandEngine::Fill(unsigned long long *output, size_t size)
 {
-    unsigned long long t = 698769069ULL * Z + C;
+    /// keep the state in local variables for the whole block
+    unsigned long long s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3];
+    for (size_t i = 0; i != size; ++i) {
+        unsigned long long x = s1 * 5;
+        output[i] = ((x << 7) | (x >> 57)) * 9;
+        unsigned long long t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = (s3 << 45) | (s3 >> 19);
+    }
+    s[0] = s0;
+    s[1] = s1;
+    s[2] = s2;
+    s[3] = s3;
+}
+
+void SFC64RandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    unsigned long long x = streamSeed(rootSeed, streamId);
+    a = splitMix64(x);
+    b = splitMix64(x);
+    c = splitMix64(x);
+    counter = 1;
+    /// skip first outputs as recommended by the author
+    for (int i = 0; i != 12; ++i)
+        Next();
+}
+
+void SFC64RandEngine::Fill(unsigned long long *output, size_t size)
+{
+    /// keep the state in local variables for the whole block
+    unsigned long long x = a, y = b, z = c, w = counter;
+    for (size_t i = 0; i != size; ++i) {
+        unsigned long long result = x + y + w++;
+        x = y ^ (y >> 11);
+        y = z + (z << 3);
+        z = ((z << 24) | (z >> 40)) + result;
+        output[i] = result;
+    }
+    a = x;
+    b = y;
+    c = z;
+    counter = w;
+}
+
+void WyRandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    unsigned long long x = streamSeed(rootSeed, streamId);
+    state = splitMix64(x);
+}
+
+void WyRandEngine::Fill(unsigned long long *output, size_t size)
+{
+    /// keep the state in local variable for the whole block
+    unsigned long long x = state;
+    for (size_t i = 0; i != size; ++i) {
+        x += 0xa0761d6478bd642fULL;
+        unsigned long long high, low = multiply128(x, x ^ 0xe7037ed1a0b428dbULL, high);
+        output[i] = high ^ low;
+    }
+    state = x;
+}
+
+void PCG64DXSMRandEngine::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    /// initialization of pcg64: inc = (sequence << 1) | 1, state = 0, step, state += initial state, step;
+    /// sequence keeps stream id in its lower half, so different ids give different increments
+    unsigned long long x = streamSeed(rootSeed, streamId);
+    unsigned long long sequenceHigh = splitMix64(x);
+    incHigh = (sequenceHigh << 1) | (streamId >> 63);
+    incLow = (streamId << 1) | 1;
+    stateHigh = 0;
+    stateLow = 0;
+    step();
+    unsigned long long low = stateLow;
+    stateLow += splitMix64(x);
+    stateHigh += splitMix64(x) + (stateLow < low);
+    step();
+}
+
+void PCG64DXSMRandEngine::Fill(unsigned long long *output, size_t size)
+{
+    for (size_t i = 0; i != size; ++i)
+        output[i] = Next();
+}
+
+RandGenerator::RandGenerator(const RandGenerator &other) :
+    defaultGenerator(other.defaultGenerator),
+    generator(other.generator ? other.generator->Clone() : nullptr)
+{
+}
+
+RandGenerator &RandGenerator::operator=(const RandGenerator &other)
+{
+    if (this != &other) {
+        defaultGenerator = other.defaultGenerator;
+        generator.reset(other.generator ? other.generator->Clone() : nullptr);
+    }
+    return *this;
+}
+
+void RandGenerator::SetEngine(const RandGenerator &prototype)
+{
+    /// prototype can be this generator itself, so spawn before reset
+    AnyGenerator *spawned = prototype.generator ? prototype.generator->Spawn() : nullptr;
+    defaultGenerator = DefaultRandGenerator();
+    generator.reset(spawned);
+}
+
+void RandGenerator::Reseed(unsigned long seed)
+{
+    if (generator)
+        generator->Reseed(seed);
+    else
+        defaultGenerator.Reseed(seed);
+}
 
-    X *= 69069;
-    X += 12345;
+void RandGenerator::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    if (generator)
+        generator->ReseedStream(rootSeed, streamId);
+    else
+        defaultGenerator.ReseedStream(rootSeed, streamId);
+}
 
-    Y ^= Y << 13;
-    Y ^= Y >> 17;
-    Y ^= Y << 5;
+RandGenerator RandGenerator::Stream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    RandGenerator randGenerator;
+    randGenerator.ReseedStream(rootSeed, streamId);
+    return randGenerator;
+}
 
-    C = t >> 32;
-    Z = t;
+void RandGenerator::SaveState(std::ostream &outputStream) const
+{
+    if (generator)
+        generator->SaveState(outputStream);
+    else
+        defaultGenerator.SaveState(outputStream);
+}
 
-    return X + Y + Z;
+void RandGenerator::LoadState(std::istream &inputStream)
+{
+    if (generator)
+        generator->LoadState(inputStream);
+    else
+        defaultGenerator.LoadState(inputStream);
 }
 
-void JLKiss64RandEngine::Reseed(unsigned long seed)
+void RandGenerator::Fill(unsigned long long *output, size_t size)
 {
-    X = 123456789123ULL ^ seed;
-    Y = 987654321987ULL;
-    Z1 = 43219876;
-    Z2 = 6543217;
-    C1 = 21987643;
-    C2 = 1732654;
+    if (generator)
+        generator->Fill(output, size);
+    else
+        defaultGenerator.Fill(output, size);
 }
 
-unsigned long long JLKiss64RandEngine::Next()
+void RandGenerator::FillUniform(double *output, size_t size, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
 {
-    X = 1490024343005336237ULL * X + 123456789;
-    Y ^= Y << 21;
-    Y ^= Y >> 17;
-    Y ^= Y << 30;
+    if (generator)
+        generator->FillUniform(output, size, interval, resolution);
+    else
+        defaultGenerator.FillUniform(output, size, interval, resolution);
+}
 
-    unsigned long long t = 4294584393ULL * Z1 + C1;
-    C1 = t >> 32;
-    Z1 = t;
-    t = 4246477509ULL * Z2 + C2;
-    C2 = t >> 32;
-    Z2 = t;
-    return X + Y + Z1 + (static_cast<unsigned long long>(Z2) << 32);
+void RandGenerator::Discard(unsigned long long n)
+{
+    if (generator)
+        generator->Discard(n);
+    else
+        defaultGenerator.Discard(n);
 }
 
-void PCGRandEngine::Reseed(unsigned long seed)
+void RandGenerator::Jump(unsigned int k)
 {
-    state = seed;
-    inc = seed;
+    if (generator)
+        generator->Jump(k);
+    else
+        defaultGenerator.Jump(k);
 }
 
-unsigned long long PCGRandEngine::Next()
+void RandGenerator::Fill32(unsigned int *output, size_t size)
 {
-    unsigned long long oldstate = state;
-    state = oldstate * 6364136223846793005ULL + (inc|1);
-    unsigned int xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
-    unsigned int rot = oldstate >> 59u;
-    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    unsigned long long words[BLOCK_SIZE];
+    if (maxDecimals() < 64) {
+        while (size != 0) {
+            size_t n = std::min(size, BLOCK_SIZE);
+            Fill(words, n);
+            for (size_t j = 0; j != n; ++j)
+                output[j] = words[j];
+            output += n;
+            size -= n;
+        }
+        return;
+    }
+    while (size != 0) {
+        size_t n = std::min((size + 1) / 2, BLOCK_SIZE);
+        Fill(words, n);
+        size_t m = std::min(size, 2 * n);
+        for (size_t j = 0; j != m / 2; ++j) {
+            output[2 * j] = words[j];
+            output[2 * j + 1] = words[j] >> 32;
+        }
+        if (m & 1)
+            output[m - 1] = words[m / 2];
+        output += m;
+        size -= m;
+    }
 }
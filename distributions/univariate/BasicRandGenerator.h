@@ -3,10 +3,19 @@
 
 #include "RandLib_global.h"
 #include <type_traits>
+#include <utility>
 #include <cstddef>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <memory>
+#include <stdexcept>
 
 /**
- * @brief The RandEngine class
+ * @brief The RandEngine class <BR>
+ * Common base of all engines. Engines are not polymorphic:
+ * BasicRandGenerator holds the concrete engine and calls it directly,
+ * so that Next() can be inlined into sampling loops
  */
 class RANDLIBSHARED_EXPORT RandEngine
 {
@@ -22,23 +31,58 @@ protected:
     static unsigned long mix(unsigned long a, unsigned long b, unsigned long c);
     /**
      * @fn getRandomSeed
-     * @return seed as a mix of time and thread id
+     * @return seed as a mix of time, thread id and process id
      */
     static unsigned long getRandomSeed();
+    /**
+     * @fn splitMix64
+     * SplitMix64 generator by Sebastiano Vigna, used for expansion of seeds
+     * @param x state, advanced by the call
+     * @return next output of SplitMix64
+     */
+    static unsigned long long splitMix64(unsigned long long &x);
+    /**
+     * @fn streamSeed
+     * @param rootSeed
+     * @param streamId
+     * @return initial state of SplitMix64, from which engine of given stream expands its state
+     */
+    static unsigned long long streamSeed(unsigned long long rootSeed, unsigned long long streamId);
+    /**
+     * @fn multiply128
+     * @param a
+     * @param b
+     * @param high upper 64 bits of a * b
+     * @return lower 64 bits of a * b
+     */
+    static inline unsigned long long multiply128(unsigned long long a, unsigned long long b, unsigned long long &high);
+
+    /**
+     * @fn seedLanes
+     * expand seed into the state of xoshiro256** lanes via SplitMix64
+     * @param state 4 * lanes words
+     * @param lanes
+     * @param seed initial state of SplitMix64
+     */
+    static void seedLanes(unsigned long long *state, size_t lanes, unsigned long long seed);
+    /**
+     * @fn stepLanes
+     * make given amount of steps of xoshiro256** lanes
+     * @param state 4 * lanes words, j-th word of l-th lane is in state[j * lanes + l]
+     * @param lanes should be a multiple of 4
+     * @param output steps * lanes words, output of step t for lane l is written into output[t * lanes + l]
+     * @param steps
+     */
+    static void stepLanes(unsigned long long *state, size_t lanes, unsigned long long *output, size_t steps);
 
-public:
     RandEngine() {}
-    virtual ~RandEngine() {}
-    virtual unsigned long long MinValue() const = 0;
-    virtual unsigned long long MaxValue() const = 0;
-    virtual void Reseed(unsigned long seed) = 0;
-    virtual unsigned long long Next() = 0;
+    ~RandEngine() = default;
 };
 
 /**
  * @brief The JKissRandEngine class
  */
-class RANDLIBSHARED_EXPORT JKissRandEngine : public RandEngine
+class RANDLIBSHARED_EXPORT JKissRandEngine final : public RandEngine
 {
     unsigned int X{};
     unsigned int C{};
@@ -47,16 +91,31 @@ class RANDLIBSHARED_EXPORT JKissRandEngine : public RandEngine
 
 public:
     JKissRandEngine() { this->Reseed(getRandomSeed()); }
-    unsigned long long MinValue() const { return 0; }
-    unsigned long long MaxValue() const { return 4294967295UL; }
-    void Reseed(unsigned long seed);
-    unsigned long long Next();
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 4294967295UL; }
+    static constexpr unsigned long long STATE_TAG = 1; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+    /**
+     * @fn Discard
+     * skip next n outputs in O(log(n))
+     * @param n
+     */
+    void Discard(unsigned long long n);
+    /**
+     * @fn Jump
+     * skip next 2^k outputs in O(k)
+     * @param k
+     */
+    void Jump(unsigned int k);
 };
 
 /**
  * @brief The JLKiss64RandEngine class
  */
-class RANDLIBSHARED_EXPORT JLKiss64RandEngine : public RandEngine
+class RANDLIBSHARED_EXPORT JLKiss64RandEngine final : public RandEngine
 {
     unsigned long long X{};
     unsigned long long Y{};
@@ -67,29 +126,548 @@ class RANDLIBSHARED_EXPORT JLKiss64RandEngine : public RandEngine
 
 public:
     JLKiss64RandEngine() { this->Reseed(getRandomSeed()); }
-    unsigned long long MinValue() const { return 0; }
-    unsigned long long MaxValue() const { return 18446744073709551615ULL; }
-    void Reseed(unsigned long seed);
-    unsigned long long Next();
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
+    static constexpr unsigned long long STATE_TAG = 2; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+    /**
+     * @fn Discard
+     * skip next n outputs in O(log(n))
+     * @param n
+     */
+    void Discard(unsigned long long n);
+    /**
+     * @fn Jump
+     * skip next 2^k outputs in O(k)
+     * @param k
+     */
+    void Jump(unsigned int k);
 };
 
 /**
  * @brief The PCGRandEngine class
  * Random number generator, taken from http://www.pcg-random.org/
  */
-class RANDLIBSHARED_EXPORT PCGRandEngine : public RandEngine
+class RANDLIBSHARED_EXPORT PCGRandEngine final : public RandEngine
 {
     unsigned long long state{};
     unsigned long long inc{};
 
 public:
     PCGRandEngine() { this->Reseed(getRandomSeed()); }
-    unsigned long long MinValue() const { return 0; }
-    unsigned long long MaxValue() const { return 4294967295UL; }
-    void Reseed(unsigned long seed);
-    unsigned long long Next();
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 4294967295UL; }
+    static constexpr unsigned long long STATE_TAG = 3; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+    /**
+     * @fn Discard
+     * skip next n outputs in O(log(n))
+     * @param n
+     */
+    void Discard(unsigned long long n);
+    /**
+     * @fn Jump
+     * skip next 2^k outputs in O(k)
+     * @param k
+     */
+    void Jump(unsigned int k);
+};
+
+/**
+ * @brief The PhiloxRandEngine class <BR>
+ * Counter-based generator Philox4x32-10 by Salmon, Moraes, Dror and Shaw.
+ * I-th output is a pure function of the key (seed) and i,
+ * therefore any output can be accessed directly and both Discard(n) and Jump(k) take O(1).
+ * Stream id goes into the upper half of the counter, so streams never overlap
+ */
+class RANDLIBSHARED_EXPORT PhiloxRandEngine final : public RandEngine
+{
+    unsigned int key[2]{};
+    unsigned long long stream = 0; ///< upper half of the counter
+    unsigned long long index = 0; ///< index of the next output
+    unsigned long long block[2]{}; ///< outputs of the counter index / 2
+
+    /**
+     * @fn generateBlock
+     * @param counter
+     * @param output two words, produced by Philox4x32-10 for given counter and key
+     */
+    void generateBlock(unsigned long long counter, unsigned long long *output) const;
+
+public:
+    PhiloxRandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
+    static constexpr unsigned long long STATE_TAG = 4; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+
+    /**
+     * @fn Discard
+     * skip next n outputs in O(1)
+     * @param n
+     */
+    void Discard(unsigned long long n);
+    /**
+     * @fn Jump
+     * skip next 2^k outputs in O(1) by moving the counter;
+     * outputs of one stream repeat with period 2^64, so jumps with k >= 64 keep the position
+     * @param k
+     */
+    void Jump(unsigned int k);
+    /**
+     * @fn Output
+     * @param i
+     * @return i-th output of the engine since the last reseed, without changing the state
+     */
+    unsigned long long Output(unsigned long long i) const;
+    /**
+     * @fn Position
+     * @return index of the next output since the last reseed
+     */
+    unsigned long long Position() const { return index; }
+};
+
+inline unsigned long long PhiloxRandEngine::Next()
+{
+    if ((index & 1) == 0)
+        generateBlock(index >> 1, block);
+    return block[index++ & 1];
+}
+
+/**
+ * @brief The MultiLaneRandEngine class <BR>
+ * Lanes independent xoshiro256** generators, stepped together in SIMD registers.
+ * Every step produces Lanes 64-bit words, which are handed out lane by lane.
+ * The best of AVX-512, AVX2 and scalar code is chosen at runtime
+ * (define RANDLIB_NO_SIMD to use scalar code only); the stream doesn't depend on this choice
+ */
+template <size_t Lanes>
+class RANDLIBSHARED_EXPORT MultiLaneRandEngine final : public RandEngine
+{
+    static_assert(Lanes == 4 || Lanes == 8 || Lanes == 16, "Amount of lanes should be 4, 8 or 16");
+
+    alignas(64) unsigned long long state[4 * Lanes]{}; ///< j-th word of l-th lane is in state[j * Lanes + l]
+    alignas(64) unsigned long long buffer[Lanes]{}; ///< output of the last step
+    size_t position = Lanes; ///< amount of words of the buffer, which are already handed out
+
+public:
+    MultiLaneRandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
+    static constexpr unsigned long long STATE_TAG = 0x100 + Lanes; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+};
+
+template <size_t Lanes>
+void MultiLaneRandEngine<Lanes>::ReseedStream(unsigned long long rootSeed, unsigned long long streamId)
+{
+    seedLanes(state, Lanes, streamSeed(rootSeed, streamId));
+    position = Lanes;
+}
+
+template <size_t Lanes>
+inline unsigned long long MultiLaneRandEngine<Lanes>::Next()
+{
+    if (position == Lanes) {
+        stepLanes(state, Lanes, buffer, 1);
+        position = 0;
+    }
+    return buffer[position++];
+}
+
+template <size_t Lanes>
+void MultiLaneRandEngine<Lanes>::Fill(unsigned long long *output, size_t size)
+{
+    /// hand out what is left from the last step
+    while (position != Lanes && size > 0) {
+        *output++ = buffer[position++];
+        --size;
+    }
+    /// write whole steps directly into the output
+    size_t steps = size / Lanes;
+    stepLanes(state, Lanes, output, steps);
+    output += steps * Lanes;
+    size -= steps * Lanes;
+    if (size > 0) {
+        stepLanes(state, Lanes, buffer, 1);
+        for (position = 0; position != size; ++position)
+            output[position] = buffer[position];
+    }
+}
+
+/**
+ * @brief The Xoshiro256RandEngine class <BR>
+ * xoshiro256** by David Blackman and Sebastiano Vigna, http://prng.di.unimi.it/ <BR>
+ * Throughput (x86-64, -O2): ~1.4 ns per Next(), ~1.2 ns per word in Fill()
+ */
+class RANDLIBSHARED_EXPORT Xoshiro256RandEngine final : public RandEngine
+{
+    unsigned long long s[4]{};
+
+public:
+    Xoshiro256RandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
+    static constexpr unsigned long long STATE_TAG = 5; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+};
+
+/**
+ * @brief The SFC64RandEngine class <BR>
+ * Small Fast Chaotic generator by Chris Doty-Humphrey, 256-bit state with counter,
+ * which guarantees period of at least 2^64 <BR>
+ * Throughput (x86-64, -O2): ~1.2 ns per Next(), ~1.4 ns per word in Fill()
+ */
+class RANDLIBSHARED_EXPORT SFC64RandEngine final : public RandEngine
+{
+    unsigned long long a{};
+    unsigned long long b{};
+    unsigned long long c{};
+    unsigned long long counter{};
+
+public:
+    SFC64RandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
+    static constexpr unsigned long long STATE_TAG = 6; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+};
+
+/**
+ * @brief The WyRandEngine class <BR>
+ * wyrand by Wang Yi: Weyl sequence, mixed by 128-bit multiplication, period 2^64 <BR>
+ * Throughput (x86-64, -O2): ~1.4 ns per Next(), ~1.4 ns per word in Fill()
+ */
+class RANDLIBSHARED_EXPORT WyRandEngine final : public RandEngine
+{
+    unsigned long long state{};
+
+public:
+    WyRandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
+    static constexpr unsigned long long STATE_TAG = 7; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+};
+
+/**
+ * @brief The PCG64DXSMRandEngine class <BR>
+ * 128-bit LCG with cheap multiplier and DXSM output function, http://www.pcg-random.org/ <BR>
+ * Throughput (x86-64, -O2): ~3.1 ns per Next(), ~2.6 ns per word in Fill()
+ */
+class RANDLIBSHARED_EXPORT PCG64DXSMRandEngine final : public RandEngine
+{
+    unsigned long long stateHigh{};
+    unsigned long long stateLow{};
+    unsigned long long incHigh{};
+    unsigned long long incLow{};
+
+    /**
+     * @fn step
+     * make one step of LCG
+     */
+    inline void step();
+
+public:
+    PCG64DXSMRandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
+    static constexpr unsigned long long STATE_TAG = 8; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { this->ReseedStream(seed, 0); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    inline unsigned long long Next();
+    void Fill(unsigned long long *output, size_t size);
+};
+
+inline unsigned long long RandEngine::multiply128(unsigned long long a, unsigned long long b, unsigned long long &high)
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128;
+    uint128 product = static_cast<uint128>(a) * b;
+    high = product >> 64;
+    return product;
+#else
+    unsigned long long aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+    unsigned long long bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+    unsigned long long low = aLow * bLow, cross1 = aLow * bHigh, cross2 = aHigh * bLow;
+    unsigned long long middle = (low >> 32) + (cross1 & 0xFFFFFFFF) + (cross2 & 0xFFFFFFFF);
+    high = aHigh * bHigh + (cross1 >> 32) + (cross2 >> 32) + (middle >> 32);
+    return (middle << 32) | (low & 0xFFFFFFFF);
+#endif
+}
+
+inline unsigned long long Xoshiro256RandEngine::Next()
+{
+    unsigned long long x = s[1] * 5;
+    unsigned long long result = ((x << 7) | (x >> 57)) * 9;
+    unsigned long long t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return result;
+}
+
+inline unsigned long long SFC64RandEngine::Next()
+{
+    unsigned long long result = a + b + counter++;
+    a = b ^ (b >> 11);
+    b = c + (c << 3);
+    c = ((c << 24) | (c >> 40)) + result;
+    return result;
+}
+
+inline unsigned long long WyRandEngine::Next()
+{
+    state += 0xa0761d6478bd642fULL;
+    unsigned long long high, low = multiply128(state, state ^ 0xe7037ed1a0b428dbULL, high);
+    return high ^ low;
+}
+
+inline void PCG64DXSMRandEngine::step()
+{
+    /// state = state * multiplier + inc modulo 2^128
+    static constexpr unsigned long long multiplier = 0xda942042e4dd58b5ULL;
+    unsigned long long high, low = multiply128(stateLow, multiplier, high);
+    high += stateHigh * multiplier;
+    stateLow = low + incLow;
+    stateHigh = high + incHigh + (stateLow < low);
+}
+
+inline unsigned long long PCG64DXSMRandEngine::Next()
+{
+    /// DXSM output function of the state before the step
+    unsigned long long high = stateHigh, low = stateLow | 1;
+    high ^= high >> 32;
+    high *= 0xda942042e4dd58b5ULL;
+    high ^= high >> 48;
+    high *= low;
+    step();
+    return high;
+}
+
+inline unsigned long long JKissRandEngine::Next()
+{
+    unsigned long long t = 698769069ULL * Z + C;
+
+    X *= 69069;
+    X += 12345;
+
+    Y ^= Y << 13;
+    Y ^= Y >> 17;
+    Y ^= Y << 5;
+
+    C = t >> 32;
+    Z = t;
+
+    return X + Y + Z;
+}
+
+inline unsigned long long JLKiss64RandEngine::Next()
+{
+    X = 1490024343005336237ULL * X + 123456789;
+    Y ^= Y << 21;
+    Y ^= Y >> 17;
+    Y ^= Y << 30;
+
+    unsigned long long t = 4294584393ULL * Z1 + C1;
+    C1 = t >> 32;
+    Z1 = t;
+    t = 4246477509ULL * Z2 + C2;
+    C2 = t >> 32;
+    Z2 = t;
+    return X + Y + Z1 + (static_cast<unsigned long long>(Z2) << 32);
+}
+
+inline unsigned long long PCGRandEngine::Next()
+{
+    unsigned long long oldstate = state;
+    state = oldstate * 6364136223846793005ULL + (inc|1);
+    unsigned int xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
+    unsigned int rot = oldstate >> 59u;
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+/**
+ * @brief The UNIFORM_INTERVAL enum
+ * interval of standard uniform variate
+ */
+enum UNIFORM_INTERVAL {
+    OPEN_INTERVAL, ///< (0, 1)
+    HALF_OPEN_INTERVAL, ///< [0, 1)
+    CLOSED_INTERVAL ///< [0, 1]
+};
+
+/**
+ * @brief The UNIFORM_RESOLUTION enum
+ * amount of random bits in standard uniform variate
+ */
+enum UNIFORM_RESOLUTION {
+    RESOLUTION_32,
+    RESOLUTION_53
+};
+
+/// conversion, used when interval and resolution are not given
+#if defined(RANDLIB_UNIDBL) || defined(RANDLIB_JLKISS64)
+constexpr UNIFORM_INTERVAL DEFAULT_UNIFORM_INTERVAL = HALF_OPEN_INTERVAL;
+constexpr UNIFORM_RESOLUTION DEFAULT_UNIFORM_RESOLUTION = RESOLUTION_53;
+#elif defined(RANDLIB_UNICLOSED)
+constexpr UNIFORM_INTERVAL DEFAULT_UNIFORM_INTERVAL = CLOSED_INTERVAL;
+constexpr UNIFORM_RESOLUTION DEFAULT_UNIFORM_RESOLUTION = RESOLUTION_32;
+#elif defined(RANDLIB_UNIHALFCLOSED)
+constexpr UNIFORM_INTERVAL DEFAULT_UNIFORM_INTERVAL = HALF_OPEN_INTERVAL;
+constexpr UNIFORM_RESOLUTION DEFAULT_UNIFORM_RESOLUTION = RESOLUTION_32;
+#else
+constexpr UNIFORM_INTERVAL DEFAULT_UNIFORM_INTERVAL = OPEN_INTERVAL;
+constexpr UNIFORM_RESOLUTION DEFAULT_UNIFORM_RESOLUTION = RESOLUTION_32;
+#endif
+
+/**
+ * @brief The UniformConversion class
+ * Conversion of random bits into standard uniform variates.
+ * Batch conversion gives exactly the same values as one by one conversion
+ */
+class RANDLIBSHARED_EXPORT UniformConversion
+{
+public:
+    /**
+     * @fn FromBits
+     * @param bits 32 random bits for RESOLUTION_32, 53 random bits for RESOLUTION_53
+     * @param interval
+     * @param resolution
+     * @return standard uniform variate
+     */
+    static double FromBits(unsigned long long bits, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+    {
+        if (resolution == RESOLUTION_32) {
+            if (interval == OPEN_INTERVAL)
+                return (bits + 0.5) * 2.3283064365386963e-10; /// 2^-32
+            if (interval == HALF_OPEN_INTERVAL)
+                return bits * 2.3283064365386963e-10;
+            return bits / 4294967295.0;
+        }
+        if (interval == OPEN_INTERVAL)
+            return ((bits >> 1) + 0.5) * 2.220446049250313e-16; /// 2^-52
+        if (interval == HALF_OPEN_INTERVAL)
+            return bits * 1.1102230246251565e-16; /// 2^-53
+        return bits / 9007199254740991.0;
+    }
+
+    /**
+     * @fn FromBits24
+     * @param bits 24 random bits
+     * @param interval
+     * @return standard uniform variate in single precision
+     */
+    static float FromBits24(unsigned int bits, UNIFORM_INTERVAL interval)
+    {
+        if (interval == OPEN_INTERVAL)
+            return ((bits >> 1) + 0.5f) * 1.1920929e-7f; /// 2^-23
+        if (interval == HALF_OPEN_INTERVAL)
+            return bits * 5.96046448e-8f; /// 2^-24
+        return bits / 16777215.0f;
+    }
+
+    /**
+     * @fn FromWord
+     * @param word output of the engine
+     * @param shift32 shift, which takes 32 random bits of the word (32 for 64-bit engines, 0 otherwise)
+     * @param interval
+     * @param resolution RESOLUTION_53 is allowed only for 64-bit engines
+     * @return standard uniform variate
+     */
+    static double FromWord(unsigned long long word, int shift32, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+    {
+        return FromBits(word >> ((resolution == RESOLUTION_32) ? shift32 : 11), interval, resolution);
+    }
+
+    /**
+     * @fn FromWords
+     * the same as FromWord() for each word, made in SIMD registers if possible
+     * @param words
+     * @param output
+     * @param size
+     * @param shift32
+     * @param interval
+     * @param resolution
+     */
+    static void FromWords(const unsigned long long *words, double *output, size_t size, int shift32,
+                          UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution);
 };
 
+/**
+ * @brief The IsRandEngine struct
+ * Compile-time check of the engine interface: engine should be a descendant of RandEngine
+ * and provide MinValue(), MaxValue(), Reseed(seed), ReseedStream(rootSeed, streamId), Next() and Fill(output, size)
+ */
+template <class Engine, class = void>
+struct IsRandEngine : std::false_type {};
+
+template <class Engine>
+struct IsRandEngine<Engine, std::void_t<
+        decltype(std::declval<const Engine &>().MinValue()),
+        decltype(std::declval<const Engine &>().MaxValue()),
+        decltype(std::declval<Engine &>().Reseed(0ul)),
+        decltype(std::declval<Engine &>().ReseedStream(0ull, 0ull)),
+        decltype(std::declval<Engine &>().Next()),
+        decltype(std::declval<Engine &>().Fill(nullptr, 0))>>
+    : std::integral_constant<bool, std::is_base_of<RandEngine, Engine>::value &&
+                                   std::is_same<decltype(std::declval<Engine &>().Next()), unsigned long long>::value> {};
+
+/**
+ * @brief The HasDiscard struct
+ * Compile-time check, whether engine can skip words faster than by generating them
+ */
+template <class Engine, class = void>
+struct HasDiscard : std::false_type {};
+
+template <class Engine>
+struct HasDiscard<Engine, std::void_t<decltype(std::declval<Engine &>().Discard(0ull))>> : std::true_type {};
+
+/**
+ * @brief The HasJump struct
+ * Compile-time check, whether engine can jump on 2^k words
+ */
+template <class Engine, class = void>
+struct HasJump : std::false_type {};
+
+template <class Engine>
+struct HasJump<Engine, std::void_t<decltype(std::declval<Engine &>().Jump(0u))>> : std::true_type {};
+
+/**
+ * @brief The EngineStateTag struct
+ * Identifier of the engine in saved state, given by static member STATE_TAG,
+ * engines without it get zero and are recognized by the size of the state only
+ */
+template <class Engine, class = void>
+struct EngineStateTag : std::integral_constant<unsigned long long, 0> {};
+
+template <class Engine>
+struct EngineStateTag<Engine, std::void_t<decltype(Engine::STATE_TAG)>> : std::integral_constant<unsigned long long, Engine::STATE_TAG> {};
+
 /**
  * @brief The BasicRandGenerator class
  * Class for generators of random number, evenly spreaded from 0 to some integer value
@@ -97,7 +675,7 @@ public:
 template <class Engine>
 class RANDLIBSHARED_EXPORT BasicRandGenerator
 {
-    static_assert(std::is_base_of<RandEngine, Engine>::value, "Engine must be a descendant of RandEngine");
+    static_assert(IsRandEngine<Engine>::value, "Engine must be a descendant of RandEngine and provide MinValue, MaxValue, Reseed, ReseedStream, Next and Fill");
 
     Engine engine{};
 
@@ -106,7 +684,7 @@ class RANDLIBSHARED_EXPORT BasicRandGenerator
      * @param value
      * @return decimals of given value
      */
-    static size_t getDecimals(unsigned long long value)
+    static constexpr size_t getDecimals(unsigned long long value)
     {
         size_t num = 0;
         unsigned long long maxRand = value;
@@ -117,20 +695,473 @@ class RANDLIBSHARED_EXPORT BasicRandGenerator
         return num;
     }
 
+    /// 32-bit conversions take upper half of the word of 64-bit engines
+    static constexpr int SHIFT_32 = (Engine::MaxValue() > 4294967295ULL) ? 32 : 0;
+
+    /**
+     * @fn wordsPerUniform
+     * @param resolution
+     * @return 2 for 53-bit variate of 32-bit engine, 1 otherwise
+     */
+    static constexpr size_t wordsPerUniform(UNIFORM_RESOLUTION resolution) { return (resolution == RESOLUTION_53 && SHIFT_32 == 0) ? 2 : 1; }
+
+    /**
+     * @fn bitsOfTwoWords
+     * @param words two consecutive outputs of 32-bit engine
+     * @return 53 random bits
+     */
+    static unsigned long long bitsOfTwoWords(const unsigned long long *words) { return ((words[0] >> 6) << 27) | (words[1] >> 5); }
+
 public:
+    /**
+     * @brief BLOCK_SIZE
+     * preferred amount of words for one bulk call of the engine
+     */
+    static constexpr size_t BLOCK_SIZE = 256;
+
+    typedef Engine EngineType;
+
     BasicRandGenerator() {}
+    explicit BasicRandGenerator(const Engine &initialEngine) : engine(initialEngine) {}
 
     unsigned long long Variate() { return engine.Next(); }
     size_t maxDecimals() { return getDecimals(engine.MaxValue()); }
     unsigned long long MaxValue() { return engine.MaxValue(); }
     void Reseed(unsigned long seed) { engine.Reseed(seed); }
+
+    /**
+     * @fn ReseedStream
+     * set the engine to the beginning of the stream with given id, derived from the root seed.
+     * Streams with different ids are statistically independent, so they can be given
+     * to different threads, processes or ranks without coordination
+     * @param rootSeed
+     * @param streamId
+     */
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId) { engine.ReseedStream(rootSeed, streamId); }
+
+    /**
+     * @fn Stream
+     * @param rootSeed
+     * @param streamId
+     * @return generator, set to the beginning of the stream with given id
+     */
+    static BasicRandGenerator Stream(unsigned long long rootSeed, unsigned long long streamId)
+    {
+        BasicRandGenerator generator;
+        generator.ReseedStream(rootSeed, streamId);
+        return generator;
+    }
+
+    /**
+     * @fn SaveState
+     * write binary state of the engine, so that it can be resumed by LoadState
+     * @param outputStream
+     */
+    void SaveState(std::ostream &outputStream) const;
+
+    /**
+     * @fn LoadState
+     * read binary state, written by SaveState of the generator with the same engine.
+     * If state can't be read or belongs to another engine, failbit of the stream is set and the engine is left untouched
+     * @param inputStream
+     */
+    void LoadState(std::istream &inputStream);
+
+    /**
+     * @fn UniformVariate
+     * @param interval
+     * @param resolution
+     * @return standard uniform variate
+     */
+    double UniformVariate(UNIFORM_INTERVAL interval = DEFAULT_UNIFORM_INTERVAL, UNIFORM_RESOLUTION resolution = DEFAULT_UNIFORM_RESOLUTION);
+
+    /**
+     * @fn Fill
+     * fill output with consecutive words of the engine, the same as size calls of Variate()
+     * @param output
+     * @param size
+     */
+    void Fill(unsigned long long *output, size_t size) { engine.Fill(output, size); }
+
+    /**
+     * @fn Discard
+     * skip next n words of the engine, the same as n calls of Variate().
+     * Engines without fast discard generate and drop the words
+     * @param n
+     */
+    void Discard(unsigned long long n);
+
+    /**
+     * @fn Jump
+     * skip next 2^k words of the engine.
+     * Engines without jump-ahead discard the words, which is possible only for k < 64
+     * @param k
+     */
+    void Jump(unsigned int k);
+
+    /**
+     * @fn FillUniform
+     * fill output with standard uniform variates, the same as size calls of UniformVariate()
+     * @param output
+     * @param size
+     * @param interval
+     * @param resolution
+     */
+    void FillUniform(double *output, size_t size, UNIFORM_INTERVAL interval = DEFAULT_UNIFORM_INTERVAL,
+                     UNIFORM_RESOLUTION resolution = DEFAULT_UNIFORM_RESOLUTION);
+};
+
+template <class Engine>
+void BasicRandGenerator<Engine>::Discard(unsigned long long n)
+{
+    if constexpr (HasDiscard<Engine>::value) {
+        engine.Discard(n);
+    }
+    else {
+        unsigned long long words[BLOCK_SIZE];
+        while (n > 0) {
+            size_t size = (n < BLOCK_SIZE) ? n : BLOCK_SIZE;
+            engine.Fill(words, size);
+            n -= size;
+        }
+    }
+}
+
+template <class Engine>
+void BasicRandGenerator<Engine>::Jump(unsigned int k)
+{
+    if constexpr (HasJump<Engine>::value) {
+        engine.Jump(k);
+    }
+    else {
+        if (k >= 64)
+            throw std::invalid_argument("Random generator: engine can't jump further than 2^63 words");
+        Discard(1ULL << k);
+    }
+}
+
+template <class Engine>
+void BasicRandGenerator<Engine>::SaveState(std::ostream &outputStream) const
+{
+    static_assert(std::is_trivially_copyable<Engine>::value, "State of engine should be trivially copyable");
+    /// size and tag of the engine mark the format of the state
+    unsigned long long header[2] = {sizeof(Engine), EngineStateTag<Engine>::value};
+    outputStream.write(reinterpret_cast<const char *>(header), sizeof(header));
+    outputStream.write(reinterpret_cast<const char *>(&engine), sizeof(Engine));
+}
+
+template <class Engine>
+void BasicRandGenerator<Engine>::LoadState(std::istream &inputStream)
+{
+    static_assert(std::is_trivially_copyable<Engine>::value, "State of engine should be trivially copyable");
+    unsigned long long header[2] = {0, 0};
+    inputStream.read(reinterpret_cast<char *>(header), sizeof(header));
+    if (!inputStream || header[0] != sizeof(Engine) || header[1] != EngineStateTag<Engine>::value) {
+        inputStream.setstate(std::ios_base::failbit);
+        return;
+    }
+    char state[sizeof(Engine)];
+    if (inputStream.read(state, sizeof(Engine)))
+        std::memcpy(static_cast<void *>(&engine), state, sizeof(Engine));
+}
+
+template <class Engine>
+double BasicRandGenerator<Engine>::UniformVariate(UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+{
+    if (wordsPerUniform(resolution) == 2) {
+        unsigned long long words[2];
+        words[0] = engine.Next();
+        words[1] = engine.Next();
+        return UniformConversion::FromBits(bitsOfTwoWords(words), interval, resolution);
+    }
+    return UniformConversion::FromWord(engine.Next(), SHIFT_32, interval, resolution);
+}
+
+template <class Engine>
+void BasicRandGenerator<Engine>::FillUniform(double *output, size_t size, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+{
+    unsigned long long words[BLOCK_SIZE];
+    size_t wordsPerVariate = wordsPerUniform(resolution);
+    size_t blockSize = BLOCK_SIZE / wordsPerVariate;
+    while (size > 0) {
+        size_t n = (size < blockSize) ? size : blockSize;
+        engine.Fill(words, n * wordsPerVariate);
+        if (wordsPerVariate == 2) {
+            for (size_t i = 0; i != n; ++i)
+                output[i] = UniformConversion::FromBits(bitsOfTwoWords(words + 2 * i), interval, resolution);
+        }
+        else {
+            UniformConversion::FromWords(words, output, n, SHIFT_32, interval, resolution);
+        }
+        output += n;
+        size -= n;
+    }
+}
+
+/**
+ * @brief The BufferedRandGenerator class <BR>
+ * Adapter of the engine, which refills cache-line aligned buffer of N words by one bulk call
+ * and hands them out by increment of the index. It is an engine itself, so it can be given
+ * to RandGenerator, for instance RandGenerator(BufferedRandGenerator<JKissRandEngine, 1024>()).
+ * Then rejection methods, which take unpredictable amount of words per variate,
+ * get words at the speed of Fill() of the engine
+ */
+template <class Engine, size_t N>
+class RANDLIBSHARED_EXPORT BufferedRandGenerator final : public RandEngine
+{
+    static_assert(IsRandEngine<Engine>::value, "Engine must be a descendant of RandEngine and provide MinValue, MaxValue, Reseed, ReseedStream, Next and Fill");
+    static_assert(N > 0, "Buffer should not be empty");
+
+    alignas(64) unsigned long long buffer[N]{};
+    size_t index = N; ///< amount of words of the buffer, which are already handed out
+    BasicRandGenerator<Engine> generator{};
+
+public:
+    BufferedRandGenerator() {}
+    static constexpr unsigned long long MinValue() { return Engine::MinValue(); }
+    static constexpr unsigned long long MaxValue() { return Engine::MaxValue(); }
+    static constexpr unsigned long long STATE_TAG = ((EngineStateTag<Engine>::value + 1) << 32) + N; ///< mark of the engine in saved state
+    void Reseed(unsigned long seed) { generator.Reseed(seed); index = N; }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId) { generator.ReseedStream(rootSeed, streamId); index = N; }
+
+    /**
+     * @fn Refill
+     * drop the rest of the buffer and fill it with next N words of the engine
+     */
+    void Refill() { generator.Fill(buffer, N); index = 0; }
+
+    unsigned long long Next()
+    {
+        if (index == N)
+            Refill();
+        return buffer[index++];
+    }
+
+    void Fill(unsigned long long *output, size_t size);
+
+    /**
+     * @fn Discard
+     * skip next n words, the same as n calls of Next()
+     * @param n
+     */
+    void Discard(unsigned long long n);
+
+    /**
+     * @fn Jump
+     * skip next 2^k words, for engines without jump-ahead only k < 64 is possible
+     * @param k
+     */
+    void Jump(unsigned int k);
 };
 
-#ifdef JLKISS64RAND
-typedef BasicRandGenerator<JLKiss64RandEngine> RandGenerator;
+template <class Engine, size_t N>
+void BufferedRandGenerator<Engine, N>::Fill(unsigned long long *output, size_t size)
+{
+    /// hand out what is left in the buffer, the rest goes directly from the engine
+    while (index != N && size > 0) {
+        *output++ = buffer[index++];
+        --size;
+    }
+    generator.Fill(output, size);
+}
+
+template <class Engine, size_t N>
+void BufferedRandGenerator<Engine, N>::Discard(unsigned long long n)
+{
+    unsigned long long rest = N - index;
+    if (n <= rest) {
+        index += n;
+        return;
+    }
+    index = N;
+    generator.Discard(n - rest);
+}
+
+template <class Engine, size_t N>
+void BufferedRandGenerator<Engine, N>::Jump(unsigned int k)
+{
+    if (k < 64) {
+        Discard(1ULL << k);
+        return;
+    }
+    if constexpr (!HasJump<Engine>::value)
+        throw std::invalid_argument("Random generator: engine can't jump further than 2^63 words");
+    /// engine is ahead by the rest of the buffer r, and 2^k - r = 2^63 + ... + 2^(k-1) + (2^63 - r)
+    unsigned long long rest = N - index;
+    index = N;
+    if (rest == 0) {
+        generator.Jump(k);
+        return;
+    }
+    for (unsigned int i = 63; i != k; ++i)
+        generator.Jump(i);
+    generator.Discard((1ULL << 63) - rest);
+}
+
+#if defined(XOSHIRO256RAND)
+typedef BasicRandGenerator<Xoshiro256RandEngine> DefaultRandGenerator;
+#elif defined(SFC64RAND)
+typedef BasicRandGenerator<SFC64RandEngine> DefaultRandGenerator;
+#elif defined(WYRAND)
+typedef BasicRandGenerator<WyRandEngine> DefaultRandGenerator;
+#elif defined(PCG64DXSMRAND)
+typedef BasicRandGenerator<PCG64DXSMRandEngine> DefaultRandGenerator;
+#elif defined(PHILOXRAND)
+typedef BasicRandGenerator<PhiloxRandEngine> DefaultRandGenerator;
+#elif defined(MULTILANERAND)
+typedef BasicRandGenerator<MultiLaneRandEngine<8>> DefaultRandGenerator;
+#elif defined(JLKISS64RAND)
+typedef BasicRandGenerator<JLKiss64RandEngine> DefaultRandGenerator;
 #else
-typedef BasicRandGenerator<JKissRandEngine> RandGenerator;
+typedef BasicRandGenerator<JKissRandEngine> DefaultRandGenerator;
 #endif
 
 
+/**
+ * @brief The RandGenerator class <BR>
+ * Generator with engine, chosen per instance at runtime.
+ * Engine of DefaultRandGenerator, chosen at compile time, is called directly,
+ * any other engine is called through one virtual call.
+ * Choice between them costs one well-predicted branch per scalar draw, which is below the noise
+ * of the engine call (cached function pointer was measured to be no faster, as it prevents inlining);
+ * bulk calls such as Fill() and FillUniform() make this choice once per call.
+ * After SetEngine() with another engine the default one stays inside unused, it takes sizeof(DefaultRandGenerator) bytes.
+ * Forked process inherits the state of each generator, hence it should call ReseedStream() with its own stream id
+ * (or SetEngine()) before sampling, unless it is supposed to repeat the parent; only static generators
+ * of distributions are reseeded after fork automatically
+ */
+class RANDLIBSHARED_EXPORT RandGenerator
+{
+    /**
+     * @brief The AnyGenerator class
+     * Interface of BasicRandGenerator with any engine
+     */
+    class AnyGenerator
+    {
+    public:
+        virtual ~AnyGenerator() {}
+        virtual unsigned long long Variate() = 0;
+        virtual double UniformVariate(UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution) = 0;
+        virtual size_t maxDecimals() = 0;
+        virtual unsigned long long MaxValue() = 0;
+        virtual void Reseed(unsigned long seed) = 0;
+        virtual void ReseedStream(unsigned long long rootSeed, unsigned long long streamId) = 0;
+        virtual void SaveState(std::ostream &outputStream) const = 0;
+        virtual void LoadState(std::istream &inputStream) = 0;
+        virtual void Fill(unsigned long long *output, size_t size) = 0;
+        virtual void FillUniform(double *output, size_t size, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution) = 0;
+        virtual void Discard(unsigned long long n) = 0;
+        virtual void Jump(unsigned int k) = 0;
+        /// copy with the same state
+        virtual AnyGenerator *Clone() const = 0;
+        /// new randomly seeded generator with the same engine
+        virtual AnyGenerator *Spawn() const = 0;
+    };
+
+    template <class Engine>
+    class EngineGenerator final : public AnyGenerator
+    {
+        BasicRandGenerator<Engine> generator;
+
+    public:
+        EngineGenerator() : generator() {}
+        explicit EngineGenerator(const Engine &engine) : generator(engine) {}
+        unsigned long long Variate() override { return generator.Variate(); }
+        double UniformVariate(UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution) override { return generator.UniformVariate(interval, resolution); }
+        size_t maxDecimals() override { return generator.maxDecimals(); }
+        unsigned long long MaxValue() override { return generator.MaxValue(); }
+        void Reseed(unsigned long seed) override { generator.Reseed(seed); }
+        void ReseedStream(unsigned long long rootSeed, unsigned long long streamId) override { generator.ReseedStream(rootSeed, streamId); }
+        void SaveState(std::ostream &outputStream) const override { generator.SaveState(outputStream); }
+        void LoadState(std::istream &inputStream) override { generator.LoadState(inputStream); }
+        void Fill(unsigned long long *output, size_t size) override { generator.Fill(output, size); }
+        void FillUniform(double *output, size_t size, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution) override
+        {
+            generator.FillUniform(output, size, interval, resolution);
+        }
+        void Discard(unsigned long long n) override { generator.Discard(n); }
+        void Jump(unsigned int k) override { generator.Jump(k); }
+        AnyGenerator *Clone() const override { return new EngineGenerator(*this); }
+        AnyGenerator *Spawn() const override { return new EngineGenerator(); }
+    };
+
+    DefaultRandGenerator defaultGenerator{};
+    std::unique_ptr<AnyGenerator> generator{}; ///< empty for engine of DefaultRandGenerator
+
+public:
+    /**
+     * @brief BLOCK_SIZE
+     * preferred amount of words for one bulk call of the engine
+     */
+    static constexpr size_t BLOCK_SIZE = DefaultRandGenerator::BLOCK_SIZE;
+
+    RandGenerator() {}
+
+    /**
+     * @fn RandGenerator
+     * @param engine any engine, satisfying IsRandEngine, its state is copied
+     */
+    template <class Engine>
+    explicit RandGenerator(const Engine &engine);
+
+    RandGenerator(const RandGenerator &other);
+    RandGenerator &operator=(const RandGenerator &other);
+    RandGenerator(RandGenerator &&other) = default;
+    RandGenerator &operator=(RandGenerator &&other) = default;
+
+    /**
+     * @fn SetEngine
+     * replace engine by the new one of the same type as in prototype,
+     * seeded randomly as in default constructed generator
+     * @param prototype
+     */
+    void SetEngine(const RandGenerator &prototype);
+
+    unsigned long long Variate() { return generator ? generator->Variate() : defaultGenerator.Variate(); }
+    size_t maxDecimals() { return generator ? generator->maxDecimals() : defaultGenerator.maxDecimals(); }
+    unsigned long long MaxValue() { return generator ? generator->MaxValue() : defaultGenerator.MaxValue(); }
+
+    /**
+     * @fn UniformVariate
+     * @param interval
+     * @param resolution
+     * @return standard uniform variate
+     */
+    double UniformVariate(UNIFORM_INTERVAL interval = DEFAULT_UNIFORM_INTERVAL, UNIFORM_RESOLUTION resolution = DEFAULT_UNIFORM_RESOLUTION)
+    {
+        return generator ? generator->UniformVariate(interval, resolution) : defaultGenerator.UniformVariate(interval, resolution);
+    }
+
+    /// the rest forwards to generator of the chosen engine, see BasicRandGenerator
+    void Reseed(unsigned long seed);
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId);
+    static RandGenerator Stream(unsigned long long rootSeed, unsigned long long streamId);
+    void SaveState(std::ostream &outputStream) const;
+    void LoadState(std::istream &inputStream);
+    void Fill(unsigned long long *output, size_t size);
+    void FillUniform(double *output, size_t size, UNIFORM_INTERVAL interval = DEFAULT_UNIFORM_INTERVAL,
+                     UNIFORM_RESOLUTION resolution = DEFAULT_UNIFORM_RESOLUTION);
+    void Discard(unsigned long long n);
+    void Jump(unsigned int k);
+
+    /**
+     * @fn Fill32
+     * fill output with 32-bit random words for single-precision and narrow-integer samplers:
+     * each word of 64-bit engine gives two of them, lower half first
+     * @param output
+     * @param size
+     */
+    void Fill32(unsigned int *output, size_t size);
+};
+
+template <class Engine>
+RandGenerator::RandGenerator(const Engine &engine)
+{
+    static_assert(IsRandEngine<Engine>::value, "Engine must be a descendant of RandEngine and provide MinValue, MaxValue, Reseed, ReseedStream, Next and Fill");
+    if constexpr (std::is_same<Engine, DefaultRandGenerator::EngineType>::value)
+        defaultGenerator = DefaultRandGenerator(engine);
+    else
+        generator.reset(new EngineGenerator<Engine>(engine));
+}
+
 #endif // BASICRANDGENERATOR_H
@@ -73,6 +73,21 @@ void BetaPrimeRand::Reseed(unsigned long seed) const
     B.Reseed(seed);
 }
 
+void BetaPrimeRand::SetEngine(const RandGenerator &prototype) const
+{
+    B.SetEngine(prototype);
+}
+
+void BetaPrimeRand::SaveState(std::ostream &outputStream) const
+{
+    B.SaveState(outputStream);
+}
+
+void BetaPrimeRand::LoadState(std::istream &inputStream) const
+{
+    B.LoadState(inputStream);
+}
+
 double BetaPrimeRand::Mean() const
 {
     return (beta > 1) ? alpha / (beta - 1) : INFINITY;
@@ -363,6 +363,27 @@ void BetaDistribution::Reseed(unsigned long seed) const
     GammaRV2.Reseed(seed + 2);
 }
 
+void BetaDistribution::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    GammaRV1.SetEngine(prototype);
+    GammaRV2.SetEngine(prototype);
+}
+
+void BetaDistribution::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    GammaRV1.SaveState(outputStream);
+    GammaRV2.SaveState(outputStream);
+}
+
+void BetaDistribution::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    GammaRV1.LoadState(inputStream);
+    GammaRV2.LoadState(inputStream);
+}
+
 double BetaDistribution::Mean() const
 {
     double mean = alpha / (alpha + beta);
@@ -250,3 +250,14 @@ bool ContinuousDistribution::KolmogorovSmirnovTest(const std::vector<double> &or
     double SReal = this->S(orderStatistic[n - 1]);
     return (SReal > interval || SReal < nInv - interval) ? false : true;
 }
+
+void ContinuousDistribution::Sample(std::vector<float> &outputData) const
+{
+    size_t size = outputData.size();
+    std::vector<double> block(std::min(size, RandGenerator::BLOCK_SIZE));
+    for (size_t i = 0; i < size; i += block.size()) {
+        block.resize(std::min(size - i, block.size()));
+        Sample(block);
+        std::copy(block.begin(), block.end(), outputData.begin() + i);
+    }
+}
@@ -14,6 +14,15 @@ protected:
     virtual ~ContinuousDistribution() {}
 
 public:
+    using UnivariateDistribution<double>::Sample;
+    /**
+     * @fn Sample
+     * fill vector by variates in single precision,
+     * by default they are variates of the double-precision Sample(), rounded to float
+     * @param outputData
+     */
+    virtual void Sample(std::vector<float> &outputData) const;
+
     /**
      * @fn f
      * @param x
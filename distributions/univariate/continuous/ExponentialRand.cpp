@@ -2,34 +2,232 @@
 #include "UniformRand.h"
 #include "../BasicRandGenerator.h"
 
-long double ExponentialRand::stairWidth[257] = {0};
-long double ExponentialRand::stairHeight[256] = {0};
-bool ExponentialRand::dummy = ExponentialRand::SetupTables();
+namespace
+{
+
+/**
+ * Ziggurat of 256 stairs of equal area A = 3.9496598225815571993e-3 for the standard exponential density:
+ * x_1 = 7.69711747013104972, x_{i+1} = -log(y_i) and y_{i+1} = y_i + A / x_{i+1}.
+ * The recurrence is evaluated in extended precision and rounded to double once, so that
+ * the tables are ready at compile time and don't depend on the order of static initialization.
+ */
+
+/// width of ziggurat's stairs
+alignas(64) constexpr double stairWidth[257] = {
+    8.6971174701310492, 7.6971174701310501, 6.9410336293772126, 6.4783784938325697,
+    6.1441646657724727, 5.8821443157953999, 5.6664101674540337, 5.4828906275260625,
+    5.3230905057543989, 5.1814872813015009, 5.054288489981305, 4.9387770859012514,
+    4.8329397410251129, 4.7352429966017411, 4.6444918854200852, 4.5597370617073514,
+    4.4802117465284219, 4.4052876934735732, 4.334443680317273, 4.2672424802773659,
+    4.2033137137351844, 4.1423408656640515, 4.0840513104082978, 4.0282085446479368,
+    3.9746060666737884, 3.9230625001354897, 3.8734176703995091, 3.8255294185223367,
+    3.7792709924116679, 3.7345288940397974, 3.6912010902374188, 3.6491955157608538,
+    3.6084288131289095, 3.5688252656483375, 3.5303158891293438, 3.4928376547740601,
+    3.4563328211327606, 3.4207483572511204, 3.3860354424603019, 3.3521490309001098,
+    3.3190474709707489, 3.2866921715990691, 3.2550473085704503, 3.2240795652862646,
+    3.1937579032122407, 3.1640533580259733, 3.1349388580844408, 3.1063890623398245,
+    3.0783802152540907, 3.0508900166154556, 3.0238975044556766, 2.9973829495161306,
+    2.9713277599210897, 2.9457143948950457, 2.9205262865127408, 2.8957477686001418,
+    2.8713640120155364, 2.8473609656351888, 2.8237253024500353, 2.8004443702507382,
+    2.777506146439757, 2.7548991965623455, 2.732612636194701, 2.7106360958679292,
+    2.6889596887418041, 2.667573980773267, 2.6464699631518096, 2.6256390267977885,
+    2.6050729387408356, 2.5847638202141408, 2.5647041263169053, 2.54488662711187,
+    2.525304390037828, 2.505950763528594, 2.4868193617402099, 2.4679040502973648,
+    2.4491989329782498, 2.4306983392644201, 2.4123968126888706, 2.3942890999214583,
+    2.376370140536141, 2.3586350574093373, 2.3410791477030348, 2.3236978743901964,
+    2.3064868582835798, 2.2894418705322694, 2.2725588255531548, 2.2558337743672192,
+    2.2392628983129086, 2.2228425031110364, 2.2065690132576634, 2.19043896672322,
+    2.1744490099377747, 2.1585958930438855, 2.1428764653998416, 2.1272876713173678,
+    2.1118265460190417, 2.0964902118017146, 2.0812758743932247, 2.0661808194905755,
+    2.0512024094685848, 2.0363380802487696, 2.0215853383189262, 2.0069417578945181,
+    1.9924049782135764, 1.9779727009573602, 1.9636426877895481, 1.9494127580071845,
+    1.9352807862970511, 1.9212447005915276, 1.9073024800183871, 1.8934521529393078,
+    1.879691795072211, 1.8660195276928275, 1.8524335159111751, 1.8389319670188795,
+    1.8255131289035191, 1.8121752885263902, 1.7989167704602904, 1.7857359354841253,
+    1.772631179231305, 1.7596009308890743, 1.746643651946074, 1.7337578349855711,
+    1.7209420025219351, 1.7081947058780576, 1.6955145241015377, 1.6829000629175537,
+    1.6703499537164519, 1.6578628525741725, 1.6454374393037234, 1.6330724165359911,
+    1.6207665088282577, 1.6085184617988582, 1.5963270412864832, 1.5841910325326887,
+    1.5721092393862295, 1.5600804835278879, 1.5481036037145133, 1.5361774550410319,
+    1.524300908219226, 1.5124728488721169, 1.5006921768428165, 1.4889578055167456,
+    1.4772686611561334, 1.4656236822457451, 1.4540218188487932, 1.4424620319720123,
+    1.4309432929388795, 1.4194645827699828, 1.4080248915695353, 1.3966232179170417,
+    1.3852585682631218, 1.3739299563284901, 1.3626364025050866, 1.351376933258335,
+    1.3401505805295046, 1.3289563811371163, 1.3177933761763245, 1.3066606104151739,
+    1.2955571316866008, 1.2844819902750126, 1.2734342382962411, 1.2624129290696153,
+    1.2514171164808525, 1.2404458543344066, 1.2294981956938491, 1.2185731922087903,
+    1.2076698934267613, 1.1967873460884031, 1.1859245934042024, 1.1750806743109117,
+    1.1642546227056791, 1.1534454666557747, 1.1426522275816728, 1.1318739194110787,
+    1.1211095477013306, 1.1103581087274115, 1.0996185885325978, 1.0888899619385473,
+    1.0781711915113728, 1.0674612264799681, 1.0567590016025519, 1.0460634359770447,
+    1.035373431790529, 1.0246878730026179, 1.0140056239570971, 1.0033255279156974,
+    0.99264640550727645, 0.98196705308506316, 0.97128624098390404, 0.96060271166866706,
+    0.94991517776407663, 0.93922231995526295, 0.92852278474721117, 0.91781518207004498,
+    0.90709808271569103, 0.89637001558989071, 0.88562946476175231, 0.87487486629102584,
+    0.86410460481100526, 0.85331700984237413, 0.84251035181036926, 0.83168283773427387,
+    0.82083260655441248, 0.80995772405741906, 0.79905617735548784, 0.78812586886949321,
+    0.77716460975913049, 0.76617011273543545, 0.75513998418198292, 0.74407171550050877,
+    0.73296267358436606, 0.72181009030875687, 0.71061105090965571, 0.69936248110323262,
+    0.68806113277374858, 0.67670356802952336, 0.66528614139267861, 0.65380497984766561,
+    0.64225596042453703, 0.63063468493349106, 0.61893645139487674, 0.60715622162030092,
+    0.59528858429150355, 0.58332771274877027, 0.57126731653258911, 0.55910058551154129,
+    0.54682012516331113, 0.53441788123716616, 0.52188505159213561, 0.50921198244365495,
+    0.49638804551867161, 0.48340149165346225, 0.47023927508216945, 0.45688684093142073,
+    0.44332786607355296, 0.42954394022541131, 0.41551416960035703, 0.40121467889627838,
+    0.38661797794112024, 0.3716921453299179, 0.35639976025839448, 0.34069648106484984,
+    0.32452911701691012, 0.30783295467493288, 0.29052795549123117, 0.27251318547846548,
+    0.25365836338591286, 0.23379048305967556, 0.21267151063096748, 0.18995868962243281,
+    0.16512762256418836, 0.13730498094001384, 0.10483850756582022, 0.06385216381500354,
+    0
+};
+
+/// height of ziggurat's stairs
+alignas(64) constexpr double stairHeight[256] = {
+    0.00045413435384149677, 0.00096726928232717454, 0.0015362997803015724, 0.0021459677437189063,
+    0.0027887987935740761, 0.003460264777836904, 0.0041572951208337953, 0.0048776559835423923,
+    0.005619642207205483, 0.0063819059373191791, 0.0071633531836349839, 0.00796307743801704,
+    0.0087803149858089753, 0.0096144136425022099, 0.010464810181029979, 0.011331013597834597,
+    0.012212592426255381, 0.013109164931254991, 0.014020391403181938, 0.014945968011691148,
+    0.015885621839973163, 0.016839106826039948, 0.017806200410911362, 0.01878670074469603,
+    0.019780424338009743, 0.020787204072578117, 0.021806887504283581, 0.02283933540638524,
+    0.023884420511558171, 0.024942026419731783, 0.026012046645134217, 0.0270943837809558,
+    0.028188948763978636, 0.029295660224637393, 0.030414443910466604, 0.031545232172893609,
+    0.032687963508959535, 0.03384258215087433, 0.03500903769739741, 0.036187284781931423,
+    0.037377282772959361, 0.038578995503074857, 0.039792391023374125, 0.041017441380414819,
+    0.042254122413316234, 0.043502413568888183, 0.044762297732943282, 0.04603376107617517,
+    0.047316792913181548, 0.048611385573379497, 0.049917534282706372, 0.051235237055126281,
+    0.052564494593071692, 0.053905310196046087, 0.055257689676697037, 0.056621641283742877,
+    0.057997175631200659, 0.059384305633420266, 0.060783046445479633, 0.062193415408540995,
+    0.063615431999807334, 0.065049117786753749, 0.066494496385339774, 0.067951593421936601,
+    0.069420436498728755, 0.070901055162371829, 0.072393480875708738, 0.073897746992364746,
+    0.07541388873405841, 0.076941943170480503, 0.078481949201606421, 0.080033947542319905,
+    0.081597980709237419, 0.083174093009632383, 0.084762330532368119, 0.086362741140756913,
+    0.087975374467270218, 0.089600281910032858, 0.091237516631040155, 0.092887133556043541,
+    0.094549189376055859, 0.096223742550432798, 0.097910853311492199, 0.099610583670637132,
+    0.10132299742595363, 0.10304816017125772, 0.10478613930657017, 0.10653700405000166,
+    0.1083008254510338, 0.11007767640518538, 0.1118676316700563, 0.11367076788274431,
+    0.11548716357863353, 0.11731689921155557, 0.11916005717532768, 0.12101672182667483,
+    0.12288697950954514, 0.12477091858083096, 0.12666862943751067, 0.12858020454522817,
+    0.13050573846833077, 0.13244532790138752, 0.13439907170221363, 0.13636707092642886,
+    0.1383494288635802, 0.14034625107486245, 0.1423576454324722, 0.14438372216063478,
+    0.14642459387834494, 0.14848037564386679, 0.15055118500103989, 0.15263714202744286,
+    0.15473836938446808, 0.15685499236936523, 0.15898713896931421, 0.16113493991759203,
+    0.16329852875190182, 0.165478041874936, 0.16767361861725019, 0.16988540130252766,
+    0.17211353531532006, 0.17435816917135349, 0.17661945459049488, 0.17889754657247831,
+    0.18119260347549629, 0.18350478709776746, 0.18583426276219711, 0.18818119940425429,
+    0.19054576966319539, 0.19292814997677132, 0.19532852067956322, 0.19774706610509887,
+    0.20018397469191127, 0.20263943909370902, 0.20511365629383771, 0.20760682772422204,
+    0.21011915938898826, 0.21265086199297828, 0.21520215107537868, 0.21777324714870053,
+    0.22036437584335949, 0.22297576805812017, 0.22560766011668407, 0.2282602939307167,
+    0.23093391716962741, 0.23362878343743335, 0.23634515245705964, 0.23908329026244918,
+    0.24184346939887721, 0.24462596913189211, 0.24743107566532763, 0.2502590823688623,
+    0.25311029001562946, 0.25598500703041538, 0.25888354974901623, 0.26180624268936292,
+    0.2647534188350622, 0.26772541993204479, 0.27072259679906002, 0.27374530965280297,
+    0.27679392844851736, 0.27986883323697287, 0.28297041453878075, 0.28609907373707683,
+    0.28925522348967775, 0.29243928816189257, 0.2956517042812612, 0.29889292101558179,
+    0.30216340067569353, 0.30546361924459026, 0.30879406693456019, 0.31215524877417955,
+    0.31554768522712895, 0.31897191284495724, 0.32242848495608911, 0.32591797239355619,
+    0.32944096426413633, 0.33299806876180899, 0.33658991402867755, 0.34021714906678002,
+    0.34388044470450241, 0.34758049462163698, 0.35131801643748334, 0.35509375286678746,
+    0.35890847294874978, 0.36276297335481777, 0.36665807978151416, 0.370594648435146,
+    0.37457356761590216, 0.37859575940958079, 0.38266218149600983, 0.38677382908413765,
+    0.39093173698479711, 0.39513698183329016, 0.39939068447523107, 0.40369401253053028,
+    0.4080481831520324, 0.41245446599716118, 0.41691418643300288, 0.42142872899761658,
+    0.42599954114303434, 0.43062813728845883, 0.43531610321563657, 0.4400651008423539,
+    0.44487687341454851, 0.449753251162755, 0.45469615747461545, 0.45970761564213769,
+    0.46478975625042618, 0.46994482528395998, 0.47517519303737737, 0.48048336393045421,
+    0.48587198734188491, 0.49134386959403253, 0.49690198724154955, 0.50254950184134772,
+    0.50828977641064288, 0.51412639381474856, 0.5200631773682336, 0.52610421398361973,
+    0.53225388026304321, 0.53851687200286191, 0.54489823767243961, 0.55140341654064129,
+    0.55803828226258745, 0.56480919291240017, 0.57172304866482582, 0.57878735860284503,
+    0.58601031847726803, 0.59340090169173343, 0.60096896636523223, 0.60872538207962201,
+    0.61668218091520766, 0.62485273870366587, 0.63325199421436607, 0.64189671642726609,
+    0.65080583341457099, 0.6600008410789997, 0.66950631673192473, 0.67935057226476536,
+    0.68956649611707799, 0.70019265508278816, 0.71127476080507601, 0.72286765959357202,
+    0.73503809243142348, 0.7478686219851951, 0.76146338884989628, 0.77595685204011555,
+    0.79152763697249562, 0.80842165152300838, 0.82699329664305032, 0.84778550062398961,
+    0.87170433238120359, 0.90046992992574637, 0.93814368086217459, 0.99999999999999989
+};
+
+/// stairWidth[i + 1] / stairWidth[i], the fast test of ziggurat is U < stairRatio[i]
+alignas(64) constexpr double stairRatio[256] = {
+    0.88501937527757324, 0.90177052075821251, 0.9333449223489565, 0.94841088269568241,
+    0.95735460160488217, 0.963323894015648, 0.96761273284061822, 0.97085476756194788,
+    0.97339830605926747, 0.97545129720201762, 0.97714586250685498, 0.9785701312217,
+    0.97978523431731246, 0.98083496216629573, 0.98175154014612553, 0.98255923223144104,
+    0.98327667144016007, 0.98391841394121538, 0.98449600340983368, 0.98501871716040224,
+    0.98549410007825677, 0.9859283537627439, 0.98632662483499056, 0.98669322171877949,
+    0.98703177983587342, 0.98734538903362712, 0.98763669297965662, 0.98790796748635723,
+    0.98816118281496423, 0.98839805366842159, 0.98862007962999832, 0.98882857811923941,
+    0.98902471143770976, 0.98920950910943584, 0.9893838864474741, 0.98954866007259057,
+    0.98970456095429549, 0.98985224542540928, 0.98999230452957998, 0.99012527198992917,
+    0.9902516310312921, 0.99037182024466175, 0.99048623864770002, 0.99059525006749283,
+    0.99069918694952086, 0.9907983536789351, 0.99089302948572944, 0.99098347099360529,
+    0.99106991446267267, 0.99115257776820054, 0.99123166215108904, 0.99130735377031243,
+    0.99137982508307188, 0.99144923607463231, 0.99151573535666215, 0.99157946115023932,
+    0.99164054216744935, 0.99169909840360526, 0.99175524185050956, 0.99180907713980859,
+    0.99186070212431765, 0.99191020840419331, 0.99195768180396959, 0.9920032028057294,
+    0.99204684694304823, 0.99208868515978699, 0.99212878413733729, 0.99216720659349911,
+    0.99220401155581028, 0.99223925461183005, 0.99227298813859877, 0.99230526151325427,
+    0.9923361213065709, 0.99236561146099866, 0.99239377345461544, 0.99242064645225525,
+    0.99244626744495068, 0.99247067137870859, 0.99249389127353826, 0.9925159583335591,
+    0.99253690204893663, 0.9925567502903202, 0.99257552939639315, 0.99259326425509031,
+    0.99260997837898157, 0.992625693975279, 0.99264043201087893, 0.99265421227281758,
+    0.99266705342448014, 0.99267897305787667, 0.99268998774226869, 0.99270011306940653,
+    0.99270936369561391, 0.99271775338093615, 0.99272529502555107, 0.992732000703623,
+    0.99273788169476451, 0.99274294851326073, 0.99274721093519125, 0.99275067802357997,
+    0.99275335815168708, 0.99275525902455197, 0.99275638769888153, 0.99275675060137647,
+    0.99275635354557457, 0.99275520174728582, 0.9927532998386881, 0.99275065188114386,
+    0.99274726137679481, 0.99274313127898395, 0.99273826400155163, 0.99273266142704697,
+    0.99272632491388935, 0.99271925530251537, 0.99271145292053597, 0.99270291758693296,
+    0.99269364861531273, 0.99268364481623561, 0.99267290449863754, 0.9926614254703523,
+    0.99264920503774434, 0.99263624000445749, 0.99262252666928041, 0.99260806082312947,
+    0.99259283774514362, 0.99257685219788694, 0.99256009842164672, 0.99254257012781588,
+    0.99252426049134423, 0.99250516214223861, 0.99248526715609164, 0.99246456704361197,
+    0.99244305273912992, 0.99242071458804337, 0.99239754233317123, 0.99237352509997245,
+    0.9923486513805887, 0.99232290901666131, 0.99229628518087165, 0.99226876635714678,
+    0.99224033831946779, 0.99221098610921488, 0.99218069401097442, 0.99214944552672846,
+    0.99211722334834151, 0.99208400932825092, 0.99204978444825997, 0.99201452878632423,
+    0.99197822148121495, 0.99194084069493038, 0.99190236357271777, 0.99186276620055802,
+    0.99182202355995119, 0.99178010947982886, 0.9917369965854046, 0.99169265624376002,
+    0.99164705850594392, 0.99160017204534567, 0.99155196409208468, 0.99150240036313231,
+    0.99145144498786386, 0.99139906042870551, 0.99134520739651899, 0.99128984476033,
+    0.99123292945097419, 0.99117441635819603, 0.99111425822069343, 0.99105240550855578,
+    0.99098880629748998, 0.99092340613417684, 0.99085614789203158, 0.99078697161658169,
+    0.99071581435959066, 0.99064261000097809, 0.99056728905748903, 0.99048977847696251,
+    0.99041000141693247, 0.99032787700616476, 0.99024332008758842, 0.99015624094091936,
+    0.99006654498309177, 0.98997413244440957, 0.9898788980181028, 0.98978073048071802,
+    0.98967951228048023, 0.98957511909044193, 0.98946741932286209, 0.98935627360084655,
+    0.98924153418280325, 0.98912304433473297, 0.9890006376447642, 0.98887413727364448,
+    0.98874335513410516, 0.98860809099110691, 0.98846813147392898, 0.98832324898986468,
+    0.98817320052790503, 0.98801772633919471, 0.98785654847920001, 0.98768936919438499,
+    0.98751586913370215, 0.9873357053623002, 0.98714850915145502, 0.98695388351475388,
+    0.98675140045588261, 0.98654059788784931, 0.98632097617695791, 0.9860919942571027,
+    0.9858530652507419, 0.98560355152190426, 0.98534275907338686, 0.98506993118442887,
+    0.98478424116596508, 0.98448478408730644, 0.98417056729975738, 0.98384049954802211,
+    0.98349337841764151, 0.98312787581408656, 0.98274252110380833, 0.98233568146602446,
+    0.98190553890171095, 0.9814500632171097, 0.98096698013499251, 0.98045373347714959,
+    0.97990744009148301, 0.97932483584681762, 0.97870221056073026, 0.97803532912240776,
+    0.97731933527054993, 0.97654863341021214, 0.97571674239409911, 0.97481611319623185,
+    0.97383789963829648, 0.97277166744713228, 0.97160502140444238, 0.97032312239453844,
+    0.96890805450552309, 0.9673379849854431, 0.96558603352123484, 0.96361872652487957,
+    0.96139384751146917, 0.95885738974131474, 0.95593914209661768, 0.95254613726150483,
+    0.94855265223826668, 0.94378444893278057, 0.93799298941024145, 0.93081134015791478,
+    0.92167464907904284, 0.90966709956573633, 0.89320233377216907, 0.86928175221886728,
+    0.83150825287659369, 0.76354482443446348, 0.60905258284906016, 0
+};
+
+/// single-precision tables for the float version of the batch test
+constexpr RandMath::SinglePrecisionTable<257> stairWidthSingle(stairWidth);
+constexpr RandMath::SinglePrecisionTable<256> stairRatioSingle(stairRatio);
+
+} // namespace
 
 String ExponentialRand::Name() const
 {
     return "Exponential(" + toStringWithPrecision(GetRate()) + ")";
 }
 
-bool ExponentialRand::SetupTables()
-{
-    /// Set up ziggurat tables
-    static constexpr long double A = 3.9496598225815571993e-3l; /// area under rectangle
-    /// coordinates of the implicit rectangle in base layer
-    stairHeight[0] = 0.00045413435384149675l; /// exp(-x1);
-    stairWidth[0] = 8.697117470131049720307l; /// A / stairHeight[0];
-    /// implicit value for the top layer
-    stairWidth[256] = 0;
-    stairWidth[1] = x1;
-    stairHeight[1] = 0.0009672692823271745203l;
-    for (size_t i = 2; i < 256; ++i) {
-        /// such y_i that f(x_{i+1}) = y_i
-        stairWidth[i] = -std::log(stairHeight[i - 1]);
-        stairHeight[i] = stairHeight[i - 1] + A / stairWidth[i];
-    }
-    return true;
-}
-
 double ExponentialRand::f(const double & x) const
 {
     return (x < 0.0) ? 0.0 : beta * std::exp(-beta * x);
@@ -57,25 +255,109 @@ double ExponentialRand::Variate() const
 
 void ExponentialRand::Sample(std::vector<double> &outputData) const
 {
-    for (double & var : outputData)
-        var = this->Variate();
+    /// Ziggurat algorithm: fast test for a block of candidates is made in SIMD registers,
+    /// rare rejected candidates go to the code of the tail and wedges one by one
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    unsigned long long B[blockSize];
+    double U[blockSize], X[blockSize];
+    size_t rejected[blockSize];
+    size_t size = outputData.size(), i = 0;
+    int iter = 0;
+    while (i != size) {
+        size_t n = std::min(size - i, blockSize);
+        localRandGenerator.Fill(B, n);
+        localRandGenerator.FillUniform(U, n);
+        size_t rejectedSize = RandMath::zigguratLayers(B, U, n, stairWidth, stairRatio, false, X, rejected);
+        /// accepted candidates between rejected ones are written in turn, so that the order is kept
+        size_t j = 0;
+        for (size_t r = 0; r <= rejectedSize; ++r) {
+            size_t end = (r == rejectedSize) ? n : rejected[r];
+            if (end != j)
+                iter = 0;
+            for (; j != end; ++j)
+                outputData[i++] = theta * X[j];
+            if (end == n)
+                break;
+            j = end + 1;
+            int stairId = B[end] & 255;
+            double x = X[end];
+            if (stairId == 0) /// if we catch the tail
+                x = x1 + StandardVariate(localRandGenerator);
+            else if (!isUnderWedge(stairId, x, localRandGenerator)) {
+                /// rejection - take next candidate
+                if (++iter <= MAX_ITER_REJECTION)
+                    continue;
+                x = NAN; /// fail due to some error
+            }
+            outputData[i++] = theta * x;
+            iter = 0;
+        }
+    }
+}
+
+void ExponentialRand::Sample(std::vector<float> &outputData) const
+{
+    /// ziggurat on single-precision tables, each candidate takes one 32-bit word
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    unsigned int W[blockSize];
+    float X[blockSize];
+    size_t rejected[blockSize];
+    const float scale = theta;
+    size_t size = outputData.size(), i = 0;
+    int iter = 0;
+    while (i != size) {
+        size_t n = std::min(size - i, blockSize);
+        localRandGenerator.Fill32(W, n);
+        size_t rejectedSize = RandMath::zigguratLayers(W, n, stairWidthSingle.value, stairRatioSingle.value, false, X, rejected);
+        size_t j = 0;
+        for (size_t r = 0; r <= rejectedSize; ++r) {
+            size_t end = (r == rejectedSize) ? n : rejected[r];
+            if (end != j)
+                iter = 0;
+            for (; j != end; ++j)
+                outputData[i++] = scale * X[j];
+            if (end == n)
+                break;
+            j = end + 1;
+            int stairId = W[end] & 255;
+            double x = X[end];
+            if (stairId == 0) /// if we catch the tail
+                x = x1 + StandardVariate(localRandGenerator);
+            else if (!isUnderWedge(stairId, x, localRandGenerator)) {
+                /// rejection - take next candidate
+                if (++iter <= MAX_ITER_REJECTION)
+                    continue;
+                x = NAN; /// fail due to some error
+            }
+            outputData[i++] = theta * x;
+            iter = 0;
+        }
+    }
+}
+
+bool ExponentialRand::isUnderWedge(int stairId, double x, RandGenerator &randGenerator)
+{
+    double height = stairHeight[stairId] - stairHeight[stairId - 1];
+    return stairHeight[stairId - 1] + height * UniformRand::StandardVariate(randGenerator) < std::exp(-x);
 }
 
 double ExponentialRand::StandardVariate(RandGenerator &randGenerator)
 {
-    /// Ziggurat algorithm
+    /// Ziggurat algorithm; the tail beyond x1 is exponential, shifted by x1,
+    /// therefore instead of recursion the shift is accumulated and sampling starts again
     int iter = 0;
+    double shift = 0.0;
     do {
         int stairId = randGenerator.Variate() & 255;
         /// Get horizontal coordinate
-        double x = UniformRand::StandardVariate(randGenerator) * stairWidth[stairId];
-        if (x < stairWidth[stairId + 1]) /// if we are under the upper stair - accept
-            return x;
+        double U = UniformRand::StandardVariate(randGenerator);
+        double x = U * stairWidth[stairId];
+        if (U < stairRatio[stairId]) /// if we are under the upper stair - accept
+            return shift + x;
         if (stairId == 0) /// if we catch the tail
-            return x1 + StandardVariate(randGenerator);
-        long double height = stairHeight[stairId] - stairHeight[stairId - 1];
-        if (stairHeight[stairId - 1] + height * UniformRand::StandardVariate(randGenerator) < std::exp(-x)) /// if we are under the curve - accept
-            return x;
+            shift += x1;
+        else if (isUnderWedge(stairId, x, randGenerator)) /// if we are under the curve - accept
+            return shift + x;
         /// rejection - go back
     } while (++iter <= MAX_ITER_REJECTION);
     /// fail due to some error
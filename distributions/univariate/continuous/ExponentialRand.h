@@ -16,11 +16,16 @@
  */
 class RANDLIBSHARED_EXPORT ExponentialRand : public FreeScaleGammaDistribution
 {
-    /// Tables for ziggurat
-    static long double stairWidth[257], stairHeight[256];
-    static constexpr long double x1 = 7.69711747013104972l;
-    static bool dummy;
-    static bool SetupTables();
+    static constexpr double x1 = 7.69711747013104972; ///< right boundary of ziggurat's base layer
+
+    /**
+     * @fn isUnderWedge
+     * @param stairId
+     * @param x horizontal coordinate, rejected by the fast test of ziggurat
+     * @param randGenerator
+     * @return true if random point of the wedge of given stair is under the density
+     */
+    static bool isUnderWedge(int stairId, double x, RandGenerator &randGenerator);
 
 public:
     explicit ExponentialRand(double rate = 1) : FreeScaleGammaDistribution(1, rate) {}
@@ -36,7 +41,14 @@ public:
     double F(const double & x) const override;
     double S(const double & x) const override;
     double Variate() const override;
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
+    /**
+     * @fn Sample
+     * single-precision version of Sample()
+     * @param outputData
+     */
+    void Sample(std::vector<float> &outputData) const override;
     static double StandardVariate(RandGenerator &randGenerator = staticRandGenerator);
 
     double Median() const override;
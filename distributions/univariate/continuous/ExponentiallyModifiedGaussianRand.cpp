@@ -95,6 +95,24 @@ void ExponentiallyModifiedGaussianRand::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+void ExponentiallyModifiedGaussianRand::SetEngine(const RandGenerator &prototype) const
+{
+    X.SetEngine(prototype);
+    Y.SetEngine(prototype);
+}
+
+void ExponentiallyModifiedGaussianRand::SaveState(std::ostream &outputStream) const
+{
+    X.SaveState(outputStream);
+    Y.SaveState(outputStream);
+}
+
+void ExponentiallyModifiedGaussianRand::LoadState(std::istream &inputStream) const
+{
+    X.LoadState(inputStream);
+    Y.LoadState(inputStream);
+}
+
 double ExponentiallyModifiedGaussianRand::Mean() const
 {
     return X.Mean() + Y.Mean();
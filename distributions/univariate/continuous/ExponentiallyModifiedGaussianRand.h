@@ -44,6 +44,9 @@ public:
     double Variate() const override;
     static double StandardVariate(RandGenerator &randGenerator = staticRandGenerator);
     void Reseed(unsigned long seed) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
+    void SaveState(std::ostream &outputStream) const override;
+    void LoadState(std::istream &inputStream) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -82,6 +82,21 @@ void FisherFRand::Reseed(unsigned long seed) const
     B.Reseed(seed);
 }
 
+void FisherFRand::SetEngine(const RandGenerator &prototype) const
+{
+    B.SetEngine(prototype);
+}
+
+void FisherFRand::SaveState(std::ostream &outputStream) const
+{
+    B.SaveState(outputStream);
+}
+
+void FisherFRand::LoadState(std::istream &inputStream) const
+{
+    B.LoadState(inputStream);
+}
+
 double FisherFRand::Mean() const
 {
     return (d2 > 2) ? 1 + 2.0 / (d2 - 2) : INFINITY;
@@ -41,8 +41,12 @@ public:
     double F(const double & x) const override;
     double S(const double & x) const override;
     double Variate() const override;
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
+    void SaveState(std::ostream &outputStream) const override;
+    void LoadState(std::istream &inputStream) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -181,6 +181,12 @@ double GammaDistribution::variateFishman(double shape, RandGenerator& randGenera
 double GammaDistribution::variateMarsagliaTsang(double shape, RandGenerator &randGenerator)
 {
     /// Marsaglia and Tsang’s Method (shape > 1/3)
+    if (shape < 1.0) {
+        /// squeeze of the paper holds only for shape >= 1, hence X ~ Gamma(shape + 1) is boosted:
+        /// X * U^(1 / shape) ~ Gamma(shape)
+        double U = UniformRand::StandardVariate(randGenerator);
+        return variateMarsagliaTsang(shape + 1.0, randGenerator) * std::pow(U, 1.0 / shape);
+    }
     double d = shape - 1.0 / 3;
     double c = 3 * std::sqrt(d);
     int iter = 0;
@@ -193,13 +199,54 @@ double GammaDistribution::variateMarsagliaTsang(double shape, RandGenerator &ran
         v = v * v * v;
         N *= N;
         double U = UniformRand::StandardVariate(randGenerator);
-        if (U < 1.0 - 0.331 * N * N || std::log(U) < 0.5 * N + d * (1.0 - v + std::log(v))) {
+        if (U < 1.0 - 0.0331 * N * N || std::log(U) < 0.5 * N + d * (1.0 - v + std::log(v))) {
             return d * v;
         }
     } while (++iter <= MAX_ITER_REJECTION);
     return NAN; /// shouldn't end up here
 }
 
+void GammaDistribution::sampleMarsagliaTsang(std::vector<double> &outputData) const
+{
+    /// squeeze test is made in SIMD registers, logarithmic test only for candidates, which fail it
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    double N[blockSize], U[blockSize], V[blockSize];
+    size_t rejected[blockSize];
+    /// for shape < 1 variates of shape + 1 are boosted afterwards, as in variateMarsagliaTsang()
+    double shape = (alpha < 1.0) ? alpha + 1.0 : alpha;
+    double d = shape - 1.0 / 3;
+    double c = 1.0 / (3 * std::sqrt(d));
+    double scale = theta * d;
+    size_t size = outputData.size(), i = 0;
+    while (i != size) {
+        size_t n = std::min(size - i, blockSize);
+        NormalRand::StandardSample(N, n, localRandGenerator);
+        localRandGenerator.FillUniform(U, n);
+        size_t rejectedSize = RandMath::marsagliaTsangSqueeze(N, U, n, c, 0.0331, V, rejected);
+        size_t j = 0;
+        for (size_t r = 0; r <= rejectedSize; ++r) {
+            size_t end = (r == rejectedSize) ? n : rejected[r];
+            for (; j != end; ++j)
+                outputData[i++] = scale * V[j];
+            if (end == n)
+                break;
+            j = end + 1;
+            double v = V[end];
+            if (v > 0.0 && std::log(U[end]) < 0.5 * N[end] * N[end] + d * (1.0 - v + std::log(v)))
+                outputData[i++] = scale * v;
+        }
+    }
+    if (alpha >= 1.0)
+        return;
+    double alphaInv = 1.0 / alpha;
+    for (i = 0; i < size; i += blockSize) {
+        size_t n = std::min(size - i, blockSize);
+        localRandGenerator.FillUniform(U, n);
+        for (size_t j = 0; j != n; ++j)
+            outputData[i + j] *= std::pow(U[j], alphaInv);
+    }
+}
+
 double GammaDistribution::StandardVariate(double shape, RandGenerator& randGenerator)
 {
     if (shape <= 0)
@@ -270,8 +317,7 @@ void GammaDistribution::Sample(std::vector<double> &outputData) const
             var = theta * variateFishman(alpha, localRandGenerator);
         break;
     case MARSAGLIA_TSANG:
-        for (double &var : outputData)
-            var = theta * variateMarsagliaTsang(alpha, localRandGenerator);
+        sampleMarsagliaTsang(outputData);
         break;
     default:
         return;
@@ -143,9 +143,15 @@ private:
     /**
      * @fn variateMarsagliaTsang
      * @param shape α
-     * @return gamma variate, using Marsaglia-Tsang algorithm
+     * @return gamma variate, using Marsaglia-Tsang algorithm, boosted from α + 1 if α < 1
      */
     static double variateMarsagliaTsang(double shape, RandGenerator& randGenerator);
+    /**
+     * @fn sampleMarsagliaTsang
+     * Marsaglia and Tsang's method for the whole sample: squeeze test is made for blocks of candidates
+     * @param outputData
+     */
+    void sampleMarsagliaTsang(std::vector<double> &outputData) const;
     
 public:
     /**
@@ -163,6 +169,7 @@ public:
     static double Variate(double shape, double rate, RandGenerator &randGenerator = staticRandGenerator);
 
     double Variate() const override;
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
 
     /**
@@ -402,6 +402,21 @@ void ShiftedGeometricStableDistribution::Reseed(unsigned long seed) const
     Z.Reseed(seed);
 }
 
+void ShiftedGeometricStableDistribution::SetEngine(const RandGenerator &prototype) const
+{
+    Z.SetEngine(prototype);
+}
+
+void ShiftedGeometricStableDistribution::SaveState(std::ostream &outputStream) const
+{
+    Z.SaveState(outputStream);
+}
+
+void ShiftedGeometricStableDistribution::LoadState(std::istream &inputStream) const
+{
+    Z.LoadState(inputStream);
+}
+
 double ShiftedGeometricStableDistribution::Mean() const
 {
     if (alpha > 1)
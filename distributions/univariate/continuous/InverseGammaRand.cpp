@@ -65,6 +65,21 @@ void InverseGammaRand::Reseed(unsigned long seed) const
     X.Reseed(seed);
 }
 
+void InverseGammaRand::SetEngine(const RandGenerator &prototype) const
+{
+    X.SetEngine(prototype);
+}
+
+void InverseGammaRand::SaveState(std::ostream &outputStream) const
+{
+    X.SaveState(outputStream);
+}
+
+void InverseGammaRand::LoadState(std::istream &inputStream) const
+{
+    X.LoadState(inputStream);
+}
+
 double InverseGammaRand::Mean() const
 {
     return (alpha > 1) ? beta / (alpha - 1) : INFINITY;
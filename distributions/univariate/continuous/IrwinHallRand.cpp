@@ -87,6 +87,21 @@ void IrwinHallRand::Reseed(unsigned long seed) const
     U.Reseed(seed);
 }
 
+void IrwinHallRand::SetEngine(const RandGenerator &prototype) const
+{
+    U.SetEngine(prototype);
+}
+
+void IrwinHallRand::SaveState(std::ostream &outputStream) const
+{
+    U.SaveState(outputStream);
+}
+
+void IrwinHallRand::LoadState(std::istream &inputStream) const
+{
+    U.LoadState(inputStream);
+}
+
 double IrwinHallRand::Mean() const
 {
     return 0.5 * n;
@@ -29,6 +29,7 @@ public:
     double S(const double & x) const override;
 
     double Variate() const override;
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
 
 private:
@@ -64,6 +64,21 @@ void LogNormalRand::Reseed(unsigned long seed) const
     X.Reseed(seed);
 }
 
+void LogNormalRand::SetEngine(const RandGenerator &prototype) const
+{
+    X.SetEngine(prototype);
+}
+
+void LogNormalRand::SaveState(std::ostream &outputStream) const
+{
+    X.SaveState(outputStream);
+}
+
+void LogNormalRand::LoadState(std::istream &inputStream) const
+{
+    X.LoadState(inputStream);
+}
+
 double LogNormalRand::Mean() const
 {
     return expMu * expHalfSigmaSq;
@@ -228,6 +228,24 @@ void MarchenkoPasturRand::Reseed(unsigned long seed) const
     BetaRV.Reseed(seed + 1);
 }
 
+void MarchenkoPasturRand::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    BetaRV.SetEngine(prototype);
+}
+
+void MarchenkoPasturRand::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    BetaRV.SaveState(outputStream);
+}
+
+void MarchenkoPasturRand::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    BetaRV.LoadState(inputStream);
+}
+
 double MarchenkoPasturRand::Moment(int n) const
 {
     if (n < 0)
@@ -71,6 +71,24 @@ void NakagamiDistribution::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+void NakagamiDistribution::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    Y.SetEngine(prototype);
+}
+
+void NakagamiDistribution::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    Y.SaveState(outputStream);
+}
+
+void NakagamiDistribution::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    Y.LoadState(inputStream);
+}
+
 double NakagamiDistribution::Mean() const
 {
     double y = lgammaShapeRatio;
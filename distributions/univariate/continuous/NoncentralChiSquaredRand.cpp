@@ -131,6 +131,24 @@ void NoncentralChiSquaredRand::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+void NoncentralChiSquaredRand::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    Y.SetEngine(prototype);
+}
+
+void NoncentralChiSquaredRand::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    Y.SaveState(outputStream);
+}
+
+void NoncentralChiSquaredRand::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    Y.LoadState(inputStream);
+}
+
 double NoncentralChiSquaredRand::Mean() const
 {
     return k + lambda;
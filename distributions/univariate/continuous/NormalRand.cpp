@@ -5,9 +5,226 @@
 #include "GammaRand.h"
 #include "StudentTRand.h"
 
-long double NormalRand::stairWidth[257] = {0};
-long double NormalRand::stairHeight[256] = {0};
-const bool NormalRand::dummy = NormalRand::SetupTables();
+namespace
+{
+
+/**
+ * Ziggurat of 256 stairs of equal area A = 4.92867323399e-3 for the standard normal density:
+ * x_1 = 3.6541528853610088, x_{i+1} = sqrt(-2 log(y_i)) and y_{i+1} = y_i + A / x_{i+1}.
+ * The recurrence is evaluated in extended precision and rounded to double once, so that
+ * the tables are ready at compile time and don't depend on the order of static initialization.
+ */
+
+/// width of ziggurat's stairs
+alignas(64) constexpr double stairWidth[257] = {
+    3.9107579595370918, 3.6541528853610088, 3.4492782985609645, 3.3202447338391661,
+    3.2245750520470291, 3.14788928951715, 3.083526132001233, 3.0278377917686354,
+    2.9786032798808448, 2.9343668672078547, 2.8941210536123481, 2.8571387308721325,
+    2.8228773968253251, 2.7909211740007862, 2.760944005278823, 2.7326853590428271,
+    2.7059336561218581, 2.6805146432845222, 2.6562830375755024, 2.6331163936303246,
+    2.6109105184875485, 2.5895759867069956, 2.569035452680537, 2.5492215503234608,
+    2.5300752321585169, 2.5115444416253427, 2.4935830412696807, 2.4761499396691433,
+    2.4592083743333113, 2.4427253181989572, 2.4266709849357264, 2.411018413899686,
+    2.395743119780481, 2.3808227951706264, 2.3662370567158191, 2.3519672273776604,
+    2.3379961487950318, 2.3243080188696235, 2.3108882505998505, 2.2977233489013305,
+    2.2848008027229469, 2.2721089902268248, 2.2596370951722187, 2.2473750329458086,
+    2.2353133849283289, 2.2234433400909066, 2.2117566428825457, 2.2002455466096493,
+    2.1889027716247225, 2.1777214677386429, 2.1666951803526473, 2.1558178198750646,
+    2.1450836340462049, 2.1344871828443215, 2.1240233156878165, 2.1136871506849348,
+    2.1034740557131477, 2.0933796311370512, 2.0833996939965527, 2.0735302635169797,
+    2.0637675478099573, 2.0541079316488662, 2.0445479652157341, 2.03508435372781,
+    2.0257139478620343, 2.0164337349043726, 2.0072408305586857, 1.9981324713565654,
+    1.9891060076155724, 1.9801588968985995, 1.9712886979317705, 1.9624930649424628,
+    1.9537697423827352, 1.945116560006755, 1.9365314282737598, 1.9280123340507191,
+    1.91955733659123, 1.9111645637692833, 1.9028322085484475, 1.8945585256687112,
+    1.8863418285347775, 1.8781804862909786, 1.8700729210692375, 1.8620176053976329,
+    1.8540130597581486, 1.84605785028312, 1.8381505865807291, 1.830289919680667,
+    1.8224745400917837, 1.8147031759641681, 1.8069745913486939, 1.7992875845475806,
+    1.7916409865500105, 1.7840336595472768, 1.7764644955223454, 1.7689324149090784,
+    1.7614363653167071, 1.7539753203154553, 1.7465482782794932, 1.7391542612836695,
+    1.7317923140507077, 1.7244615029457762, 1.7171609150155409, 1.7098896570690061,
+    1.7026468547976139, 1.6954316519322385, 1.6882432094348585, 1.6810807047228231,
+    1.6739433309237604, 1.6668302961592867, 1.6597408228557895, 1.6526741470806485,
+    1.6456295179023606, 1.6386061967731114, 1.6316034569324225, 1.6246205828305689,
+    1.6176568695705347, 1.6107116223673341, 1.6037841560235833, 1.5968737944202616,
+    1.5899798700216488, 1.5831017233934717, 1.5762387027333329, 1.5693901634125342,
+    1.5625554675284394, 1.5557339834665547, 1.5489250854715353, 1.5421281532263473,
+    1.5353425714388427, 1.5285677294350239, 1.5218030207582924, 1.5150478427739917,
+    1.5083015962785713, 1.5015636851127059, 1.4948335157777179, 1.4881104970546537,
+    1.4813940396253753, 1.4746835556950251, 1.4679784586152305, 1.4612781625074076,
+    1.4545820818855231, 1.4478896312776697, 1.441200224845798, 1.4345132760029464,
+    1.4278281970272901, 1.4211443986723227, 1.4144612897724644, 1.4077782768433711,
+    1.4010947636762021, 1.3944101509250708, 1.3877238356868842, 1.3810352110727415,
+    1.3743436657700301, 1.3676485835943175, 1.3609493430301014, 1.3542453167594299,
+    1.3475358711773586, 1.3408203658931515, 1.3340981532160832, 1.3273685776246245,
+    1.3206309752177299, 1.3138846731468685, 1.3071289890273534, 1.3003632303274333,
+    1.2935866937335172, 1.286798664489786, 1.2799984157103326, 1.2731852076618431,
+    1.2663582870146877, 1.2595168860601436, 1.252660221891297, 1.245787495544997,
+    1.2388978911020267, 1.2319905747424442, 1.2250646937528074, 1.2181193754817259,
+    1.2111537262399106, 1.2041668301405593, 1.1971577478755853, 1.190125515422801,
+    1.1830691426787601, 1.1759876120114892, 1.1688798767268331, 1.1617448594415736,
+    1.1545814503558511, 1.147388505416733, 1.1401648443639949, 1.1329092486483361,
+    1.1256204592112935, 1.118297174115062, 1.1109380460092486, 1.1035416794202673,
+    1.0961066278476026, 1.0886313906495135, 1.0811144096988887, 1.0735540657878713,
+    1.065948674757506, 1.058296483326006, 1.0505956645862067, 1.0428443131393701,
+    1.0350404398286048, 1.0271819660307508, 1.0192667174605288, 1.011292417434978,
+    1.0032566795395907, 0.99515699962994242, 0.9869907470938456, 0.97875515528893708,
+    0.97044731105886384, 0.96206414321760447, 0.95360240987557177, 0.94505868446257024,
+    0.93642934028089608, 0.92771053339623399, 0.9188981836437341, 0.909987953490768,
+    0.90097522445517364, 0.89185507072679149, 0.88262222957890935, 0.87327106808249377,
+    0.86379554554682603, 0.85418917100155978, 0.84444495490242288, 0.83455535407951786,
+    0.82451220874528786, 0.81430667012806346, 0.803929116982664, 0.79336905883315179,
+    0.78261502329958776, 0.77165442421673835, 0.76047340642208217, 0.74905666200958043,
+    0.73738721142583752, 0.72544614090130222, 0.7132122851820214, 0.70066184109758312,
+    0.68776789278625627, 0.67449982282743504, 0.66082257423420454, 0.64669571488438737,
+    0.63207223637502308, 0.61689698999623388, 0.60110461774393864, 0.58461676609372049,
+    0.56733825704047136, 0.5491517023130249, 0.52990972064649333, 0.50942332958593139,
+    0.48744396612175228, 0.46363433677176097, 0.4375184021866601, 0.40838913458799792,
+    0.37512133285046234, 0.3357375191804553, 0.28617459174725512, 0.21524189591326542,
+    0
+};
+
+/// height of ziggurat's stairs
+alignas(64) constexpr double stairHeight[256] = {
+    0.0012602859304985971, 0.0026090727461063621, 0.0040379725933718715, 0.0055224032992647549,
+    0.0070508754713921092, 0.0086165827694229119, 0.0102149714397311, 0.011842757857943099,
+    0.013497450601780796, 0.015177088307982065, 0.016880083152595836, 0.018605121275783343,
+    0.020351096230109344, 0.022117062707379908, 0.023902203305873237, 0.025705804008632649,
+    0.027527235669693315, 0.029365939758230111, 0.031221417192023686, 0.033093219458688684,
+    0.034980941461833046, 0.036884215688691123, 0.038802707404656897, 0.040736110656078739,
+    0.042684144916619336, 0.044646552251446515, 0.046623094902089671, 0.048613553216035131,
+    0.050617723861121747, 0.052635418276973607, 0.05466646132507786, 0.056710690106399425,
+    0.058767952921137928, 0.06083810834975175, 0.062921024437977785, 0.065016577971470355,
+    0.06712465382802392, 0.069245144397250172, 0.071377949059141826, 0.073522973714240825,
+    0.075680130359194811, 0.077849336702372013, 0.080030515814947328, 0.082223595813495504,
+    0.084428509570654453, 0.086645194450867546, 0.088873592068593937, 0.091113648066700414,
+    0.093365311913026341, 0.095628536713353057, 0.097903279039215349, 0.10018949876917177,
+    0.10248715894230599, 0.10479622562286683, 0.10711666777507266, 0.10944845714720981,
+    0.1117915681642454, 0.11414597782825504, 0.11651166562603685, 0.11888861344334545,
+    0.12127680548523516, 0.12367622820205106, 0.12608687022064999, 0.12850872228047336,
+    0.13094177717412792, 0.13338602969216254, 0.13584147657175705, 0.13830811644906399,
+    0.14078594981496803, 0.14327497897404687, 0.14577520800653765, 0.14828664273312839,
+    0.15080929068240986, 0.15334316106083742, 0.15588826472506426, 0.15844461415651989,
+    0.16101222343811727, 0.16359110823298259, 0.16618128576510971, 0.16878277480185,
+    0.17139559563815535, 0.17401977008249914, 0.17665532144440646, 0.17930227452353026,
+    0.18196065560021638, 0.18463049242750437, 0.18731181422451676, 0.19000465167119293,
+    0.19270903690432864, 0.1954250035148854, 0.19815258654653795, 0.20089182249543117,
+    0.20364274931112133, 0.20640540639867916, 0.20917983462193548, 0.21196607630785277,
+    0.21476417525200839, 0.21757417672517823, 0.22039612748101145, 0.22323007576478943,
+    0.22607607132326474, 0.22893416541557743, 0.23180441082524855, 0.23468686187325269,
+    0.23758157443217368, 0.24048860594144916, 0.24340801542371202, 0.24633986350223877,
+    0.2492842124195167, 0.25224112605694377, 0.25521066995567709, 0.25819291133864797,
+    0.2611879191337636, 0.2641957639983174, 0.26721651834463167, 0.27025025636695982,
+    0.27329705406967564, 0.2763569892967811, 0.27943014176276515, 0.28251659308484933,
+    0.28561642681665805, 0.28872972848335393, 0.29185658561828109, 0.29499708780116268,
+    0.29815132669790145, 0.30131939610203423, 0.30450139197789644, 0.30769741250555399,
+    0.31090755812756399, 0.31413193159763048, 0.31737063803122267, 0.32062378495823052,
+    0.32389148237773235, 0.32717384281495887, 0.33047098138053732, 0.33378301583210873,
+    0.33711006663841303, 0.34045225704594562, 0.34380971314829151, 0.34718256395825153,
+    0.35057094148288126, 0.35397498080156936, 0.35739482014729063, 0.36083060099117586,
+    0.36428246813054976, 0.36775056978059639, 0.37123505766982157, 0.37473608713949164,
+    0.37825381724723833, 0.38178841087503163, 0.38534003484173424, 0.38890886002046487,
+    0.39249506146101104, 0.39609881851754741, 0.399720314981932, 0.40335973922286922,
+    0.40701728433124823, 0.41069314827198344, 0.4143875340427069, 0.41810064983968476,
+    0.42183270923135352, 0.42558393133990086, 0.42935454103134185, 0.43314476911457434,
+    0.43695485254992955, 0.44078503466777019, 0.44463556539772808, 0.4485067015092144,
+    0.45239870686388289, 0.45631185268077407, 0.46024641781492398, 0.46420268905027928,
+    0.46818096140782267, 0.4721815384698837, 0.47620473272168418, 0.48025086591125016,
+    0.48432026942891204, 0.4884132847077125, 0.4925302636461491, 0.49667156905479676,
+    0.50083757512848259, 0.50502866794582923, 0.50924524599813648, 0.51348772074974336,
+    0.51775651723220117, 0.52205207467479542, 0.52637484717418725, 0.53072530440619448,
+    0.53510393238302012, 0.53951123425954528, 0.5439477311926505, 0.54841396325792169,
+    0.55291049042852036, 0.55743789362148666, 0.56199677581727825, 0.5665877632589521,
+    0.5712115067380753, 0.57586868297521088, 0.5805599961036837, 0.58528617926630055,
+    0.59004799633579219, 0.59484624377099149, 0.59968175262216805, 0.60455539070054987,
+    0.60946806492889583, 0.61442072389207725, 0.61941436060903965, 0.62445001555027468,
+    0.62952877992812872, 0.63465179929096061, 0.63982027745643955, 0.64503548082425244,
+    0.65029874311429503, 0.65561147058322522, 0.66097514778024191, 0.6663913439123812,
+    0.67186171990076693, 0.67738803622251353, 0.68297216164879182, 0.6886160830085275,
+    0.69432191613003302, 0.70009191814049054, 0.70592850133679785, 0.71183424888235902,
+    0.71781193263490195, 0.72386453347288215, 0.72999526456580299, 0.73620759813126724,
+    0.7425052963446368, 0.74889244722372728, 0.75537350651175517, 0.76195334684154714,
+    0.7686373158033355, 0.77543130498613899, 0.78234183265986268, 0.78937614357119934,
+    0.7965423304282554, 0.80384948317639027, 0.81130787431822082, 0.81892919160941557,
+    0.82672683395209512, 0.83471629299293126, 0.84291565311844197, 0.85134625846512446,
+    0.86003362120300952, 0.86900868804379405, 0.87830965581614773, 0.88798466076340077,
+    0.89809592190630505, 0.90872644006056391, 0.91999150504836136, 0.93206007596899143,
+    0.94519895345307936, 0.95987909181241737, 0.9771017012827331, 1.000000000022752
+};
+
+/// stairWidth[i + 1] / stairWidth[i], the fast test of ziggurat is U < stairRatio[i]
+alignas(64) constexpr double stairRatio[256] = {
+    0.93438482339457873, 0.943933767078877, 0.96259114123217271, 0.97118595481318171,
+    0.97621833534896407, 0.97955355109525177, 0.98194004595756246, 0.98373938259782689,
+    0.98514860539777549, 0.98628466874907106, 0.98722157019173218, 0.9880085157655788,
+    0.98867955694410325, 0.98925904142287513, 0.98976486079327719, 0.99021047087164871,
+    0.99060619510022785, 0.99096009202198276, 0.99127854840110596, 0.99156669443231105,
+    0.99182870051291072, 0.99206799331940876, 0.99228741575504453, 0.99248934712539427,
+    0.99267579465715527, 0.99284846405344185, 0.9930088145002538, 0.9931581019935749,
+    0.99329741379120717, 0.99342769604768011, 0.99354977616116558, 0.99366438098060883,
+    0.9937721517442063, 0.99387365641643144, 0.99396939993917421, 0.99405983279868848,
+    0.99414535822376648, 0.99422633826462492, 0.99430309895119207, 0.99437593469006513,
+    0.99444511202858621, 0.9945108728902301, 0.99457343736628845, 0.99463300613352912,
+    0.99468976255523889, 0.99474387451317592, 0.99479549600995254, 0.9948447685748506,
+    0.99489182250074093, 0.99493677793540525, 0.99497974584693905, 0.99502082887992738,
+    0.99506012211659289, 0.9950977137550383, 0.99513368571496374, 0.99516811417977458,
+    0.9952010700827616, 0.9952326195439869, 0.99526282426362433, 0.99529174187674341,
+    0.99531942627388348, 0.99534592789120968, 0.99537129397356772, 0.9953955688133459,
+    0.99541879396769917, 0.99544100845638617, 0.99546224894220325, 0.99548254989577101,
+    0.9955019437462268, 0.99552046101920322, 0.99553813046331774, 0.99555497916626601,
+    0.99557103266149116, 0.99558631502630079, 0.99560084897220869, 0.99561465592819864,
+    0.99562775611753773, 0.99564016862870119, 0.99565191148091414, 0.99566300168476796,
+    0.99567345529832296, 0.99568328747906876, 0.99569251253207869, 0.9957011439546648,
+    0.99570919447780681, 0.99571667610460945, 0.99572360014601191, 0.9957299772539604,
+    0.9957358174522295, 0.99574113016506516, 0.99574592424380703, 0.99575020799162972,
+    0.99575398918653768, 0.9957572751027286, 0.99576007253043786, 0.99576238779435988,
+    0.99576422677074106, 0.99576559490322447, 0.99576649721752453, 0.99576693833499974,
+    0.99576692248518839, 0.99576645351736515, 0.99576553491117115, 0.9957641697863665,
+    0.99576236091175063, 0.99576011071328796, 0.99575742128147926, 0.99575429437800866,
+    0.99575073144169801, 0.99574673359379606, 0.99574230164262523, 0.99573743608760867,
+    0.99573213712269715, 0.99572640463921147, 0.99572023822811573, 0.99571363718173422,
+    0.99570660049492177, 0.99569912686569606, 0.9956912146953395, 0.99568286208797374,
+    0.99567406684961146, 0.99566482648668497, 0.99565513820405338, 0.99564499890248237,
+    0.99563440517559709, 0.99562335330629759, 0.99561183926263364, 0.99559985869312595,
+    0.99558740692152525, 0.99557447894099416, 0.99556106940769862, 0.99554717263379056,
+    0.99553278257976396, 0.99551789284616132, 0.99550249666460933, 0.9954865868881565,
+    0.99547015598088462, 0.9954531960067633, 0.99543569861771442, 0.99541765504084823,
+    0.99539905606483314, 0.99537989202535504, 0.99536015278961876, 0.99533982773984275,
+    0.99531890575569049, 0.99529737519558037, 0.99527522387681022, 0.99525243905442606,
+    0.99522900739876274, 0.9952049149715736, 0.99518014720066261, 0.99515468885292668,
+    0.99512852400570317, 0.99510163601631507, 0.99507400748969466, 0.99504562024395526,
+    0.99501645527377336, 0.99498649271143014, 0.99495571178534647, 0.99492409077593824,
+    0.99489160696859402, 0.99485823660357131, 0.99482395482258057, 0.99478873561181069,
+    0.99475255174112853, 0.99471537469915738, 0.99467717462391658, 0.9946379202286737,
+    0.99459757872262822, 0.99455611572601099, 0.994513495179145, 0.9944696792449691,
+    0.99442462820447763, 0.99437830034447716, 0.99433065183700187, 0.99428163660966262,
+    0.99423120620613337, 0.99417930963589496, 0.99412589321226597, 0.99407090037765133,
+    0.99401427151481903, 0.99395594374289498, 0.99389585069661779, 0.99383392228723466,
+    0.99377008444324022, 0.99370425882895308, 0.99363636253869403, 0.99356630776406962,
+    0.99349400143156341, 0.99341934480730765, 0.99334223306551539, 0.99326255481662407,
+    0.99318019159069582, 0.99309501727105276, 0.99300689747246706, 0.99291568885747405,
+    0.99282123838350766, 0.99272338247255887, 0.99262194609389565, 0.99251674174904159,
+    0.99240756834664812, 0.9922942099530736, 0.99217643440235292, 0.99205399174675046,
+    0.99192661252615288, 0.99179400583110644, 0.99165585713021331, 0.9915118258277571,
+    0.99136154251165642, 0.99120460584495684, 0.991040579045814, 0.99086898589098571,
+    0.99068930616585904, 0.99050097046948582, 0.99030335426539418, 0.99009577104727475,
+    0.98987746446202551, 0.98964759919976897, 0.9894052504196762, 0.98914939142954339,
+    0.98887887927323714, 0.98859243779956663, 0.98828863768385267, 0.98796587274272862,
+    0.98762233171446334, 0.98725596445898267, 0.98686444124682715, 0.98644510343095493,
+    0.98599490329659345, 0.98551033021549084, 0.98498731932492445, 0.98442113771148365,
+    0.98380624136205785, 0.98313609373663302, 0.98240293339698259, 0.98159747319601631,
+    0.98070850631734185, 0.97972238371257547, 0.9786223111911877, 0.97738738919589307,
+    0.97599127836112487, 0.97440030911418196, 0.97257074531867638, 0.97044472540755133,
+    0.96794407128065574, 0.96496053533935255, 0.96133984665242911, 0.95685442305509572,
+    0.95115412025831858, 0.94367126738941842, 0.93342161734665807, 0.91853896462965967,
+    0.89501046669156792, 0.85237596455056719, 0.75213489289560564, 0
+};
+
+/// single-precision tables for the float version of the batch test
+constexpr RandMath::SinglePrecisionTable<257> stairWidthSingle(stairWidth);
+constexpr RandMath::SinglePrecisionTable<256> stairRatioSingle(stairRatio);
+
+} // namespace
 
 NormalRand::NormalRand(double mean, double var)
     : StableDistribution(2.0, 0.0, 1.0, mean)
@@ -28,24 +245,6 @@ void NormalRand::SetScale(double scale)
     StableDistribution::SetScale(sigma * M_SQRT1_2);
 }
 
-bool NormalRand::SetupTables()
-{
-    static constexpr long double A = 4.92867323399e-3l; /// area under rectangle
-    /// coordinates of the implicit rectangle in base layer
-    stairHeight[0] = 0.001260285930498597l; /// exp(-0.5 * x1 * x1);
-    stairWidth[0] = 3.9107579595370918075l; /// A / stairHeight[0];
-    /// implicit value for the top layer
-    stairWidth[256] = 0.0l;
-    stairWidth[1] = x1;
-    stairHeight[1] = 0.002609072746106362l;
-    for (size_t i = 2; i <= 255; ++i) {
-        /// such y_i that f(x_{i+1}) = y_i
-        stairWidth[i] = std::sqrt(-2 * std::log(stairHeight[i - 1]));
-        stairHeight[i] = stairHeight[i - 1] + A / stairWidth[i];
-    }
-    return true;
-}
-
 void NormalRand::SetVariance(double var)
 {
     if (var <= 0.0)
@@ -78,6 +277,24 @@ double NormalRand::Variate() const
     return mu + sigma * StandardVariate(localRandGenerator);
 }
 
+double NormalRand::variateTail(RandGenerator &randGenerator)
+{
+    /// Marsaglia's method; no variate is kept between calls,
+    /// so that the output depends only on the state of generator
+    double x = 0, z = 0;
+    do {
+        x = ExponentialRand::StandardVariate(randGenerator) / x1;
+        z = ExponentialRand::StandardVariate(randGenerator) - 0.5 * x * x;
+    } while (z <= 0);
+    return x + x1;
+}
+
+bool NormalRand::isUnderWedge(int stairId, double x, RandGenerator &randGenerator)
+{
+    double height = stairHeight[stairId] - stairHeight[stairId - 1];
+    return stairHeight[stairId - 1] + height * UniformRand::StandardVariate(randGenerator) < std::exp(-.5 * x * x);
+}
+
 double NormalRand::StandardVariate(RandGenerator &randGenerator)
 {
     /// Ziggurat algorithm by George Marsaglia using 256 strips
@@ -85,39 +302,113 @@ double NormalRand::StandardVariate(RandGenerator &randGenerator)
     do {
         unsigned long long B = randGenerator.Variate();
         int stairId = B & 255;
-        double x = UniformRand::StandardVariate(randGenerator) * stairWidth[stairId]; /// Get horizontal coordinate
-        if (x < stairWidth[stairId + 1])
+        double U = UniformRand::StandardVariate(randGenerator);
+        double x = U * stairWidth[stairId]; /// Get horizontal coordinate
+        if (U < stairRatio[stairId]) /// if we are under the upper stair - accept
             return ((signed)B > 0) ? x : -x;
         if (stairId == 0) /// handle the base layer
         {
-            static thread_local double z = -1;
-            if (z > 0) /// we don't have to generate another exponential variable as we already have one
-            {
-                x = ExponentialRand::StandardVariate(randGenerator) / x1;
-                z -= 0.5 * x * x;
-            }
-            if (z <= 0) /// if previous generation wasn't successful
-            {
-                do {
-                    x = ExponentialRand::StandardVariate(randGenerator) / x1;
-                    z = ExponentialRand::StandardVariate(randGenerator) - 0.5 * x * x; /// we storage this value as after acceptance it becomes exponentially distributed
-                } while (z <= 0);
-            }
-            x += x1;
+            x = variateTail(randGenerator);
             return ((signed)B > 0) ? x : -x;
         }
         /// handle the wedges of other stairs
-        long double height = stairHeight[stairId] - stairHeight[stairId - 1];
-        if (stairHeight[stairId - 1] + height * UniformRand::StandardVariate(randGenerator) < std::exp(-.5 * x * x))
+        if (isUnderWedge(stairId, x, randGenerator))
             return ((signed)B > 0) ? x : -x;
     } while (++iter <= MAX_ITER_REJECTION);
     return NAN; /// fail due to some error
 }
 
+void NormalRand::sampleImpl(double *output, size_t size, double mean, double scale, RandGenerator &randGenerator)
+{
+    /// Ziggurat algorithm: fast test for a block of candidates is made in SIMD registers,
+    /// rare rejected candidates go to the code of the base layer and wedges one by one
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    unsigned long long B[blockSize];
+    double U[blockSize], X[blockSize];
+    size_t rejected[blockSize];
+    size_t i = 0;
+    int iter = 0;
+    while (i != size) {
+        size_t n = std::min(size - i, blockSize);
+        randGenerator.Fill(B, n);
+        randGenerator.FillUniform(U, n);
+        size_t rejectedSize = RandMath::zigguratLayers(B, U, n, stairWidth, stairRatio, true, X, rejected);
+        /// accepted candidates between rejected ones are written in turn, so that the order is kept
+        size_t j = 0;
+        for (size_t r = 0; r <= rejectedSize; ++r) {
+            size_t end = (r == rejectedSize) ? n : rejected[r];
+            if (end != j)
+                iter = 0;
+            for (; j != end; ++j)
+                output[i++] = mean + scale * X[j];
+            if (end == n)
+                break;
+            j = end + 1;
+            int stairId = B[end] & 255;
+            double x = std::fabs(X[end]);
+            if (stairId == 0) /// handle the base layer
+                x = variateTail(randGenerator);
+            else if (!isUnderWedge(stairId, x, randGenerator)) {
+                /// rejection - take next candidate
+                if (++iter <= MAX_ITER_REJECTION)
+                    continue;
+                x = NAN; /// fail due to some error
+            }
+            output[i++] = mean + scale * (((B[end] >> 8) & 1) ? -x : x);
+            iter = 0;
+        }
+    }
+}
+
+void NormalRand::StandardSample(double *output, size_t size, RandGenerator &randGenerator)
+{
+    sampleImpl(output, size, 0.0, 1.0, randGenerator);
+}
+
 void NormalRand::Sample(std::vector<double> &outputData) const
 {
-    for (double & var : outputData)
-        var = this->Variate();
+    sampleImpl(outputData.data(), outputData.size(), mu, sigma, localRandGenerator);
+}
+
+void NormalRand::Sample(std::vector<float> &outputData) const
+{
+    /// the same ziggurat, but each candidate is made of one 32-bit word
+    /// and the fast test is made for twice as many candidates in SIMD registers
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    unsigned int W[blockSize];
+    float X[blockSize];
+    size_t rejected[blockSize];
+    const float mean = mu, scale = sigma;
+    size_t size = outputData.size(), i = 0;
+    int iter = 0;
+    while (i != size) {
+        size_t n = std::min(size - i, blockSize);
+        localRandGenerator.Fill32(W, n);
+        size_t rejectedSize = RandMath::zigguratLayers(W, n, stairWidthSingle.value, stairRatioSingle.value, true, X, rejected);
+        size_t j = 0;
+        for (size_t r = 0; r <= rejectedSize; ++r) {
+            size_t end = (r == rejectedSize) ? n : rejected[r];
+            if (end != j)
+                iter = 0;
+            for (; j != end; ++j)
+                outputData[i++] = mean + scale * X[j];
+            if (end == n)
+                break;
+            j = end + 1;
+            int stairId = W[end] & 255;
+            double x = std::fabs(X[end]);
+            if (stairId == 0) /// handle the base layer
+                x = variateTail(localRandGenerator);
+            else if (!isUnderWedge(stairId, x, localRandGenerator)) {
+                /// rejection - take next candidate
+                if (++iter <= MAX_ITER_REJECTION)
+                    continue;
+                x = NAN; /// fail due to some error
+            }
+            outputData[i++] = mu + sigma * (((W[end] >> 8) & 1) ? -x : x);
+            iter = 0;
+        }
+    }
 }
 
 std::complex<double> NormalRand::CFImpl(double t) const
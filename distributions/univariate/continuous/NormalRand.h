@@ -20,11 +20,34 @@ class RANDLIBSHARED_EXPORT NormalRand : public StableDistribution
 {
     double sigma = 1; ///< scale σ
 
-    static long double stairWidth[257]; ///< width of ziggurat's stairs
-    static long double stairHeight[256]; ///< height of ziggurat's stairs
-    static constexpr long double x1 = 3.6541528853610088l; ///< starting point for ziggurat's setup
-    static const bool dummy;
-    static bool SetupTables();
+    static constexpr double x1 = 3.6541528853610088; ///< right boundary of ziggurat's base layer
+
+    /**
+     * @fn variateTail
+     * @param randGenerator
+     * @return |X| for X from the base layer of ziggurat, i.e. |X| > x1
+     */
+    static double variateTail(RandGenerator &randGenerator);
+
+    /**
+     * @fn isUnderWedge
+     * @param stairId
+     * @param x horizontal coordinate, rejected by the fast test of ziggurat
+     * @param randGenerator
+     * @return true if random point of the wedge of given stair is under the density
+     */
+    static bool isUnderWedge(int stairId, double x, RandGenerator &randGenerator);
+
+    /**
+     * @fn sampleImpl
+     * fill output by variates of N(mean, scale^2)
+     * @param output
+     * @param size
+     * @param mean
+     * @param scale
+     * @param randGenerator
+     */
+    static void sampleImpl(double *output, size_t size, double mean, double scale, RandGenerator &randGenerator);
 
 public:
     NormalRand(double mean = 0, double var = 1);
@@ -55,7 +78,22 @@ public:
     double S(const double & x) const override;
     double Variate() const override;
     static double StandardVariate(RandGenerator &randGenerator = staticRandGenerator);
+    /**
+     * @fn StandardSample
+     * fill output by standard normal variates, the same as Sample() of N(0, 1)
+     * @param output
+     * @param size
+     * @param randGenerator
+     */
+    static void StandardSample(double *output, size_t size, RandGenerator &randGenerator = staticRandGenerator);
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
+    /**
+     * @fn Sample
+     * fill vector by variates in single precision, ziggurat runs on float tables
+     * @param outputData
+     */
+    void Sample(std::vector<float> &outputData) const override;
 
 private:
     double quantileImpl(double p) const override;
@@ -0,0 +1,196 @@
+#include "NumericalInversion.h"
+#include "UniformRand.h"
+
+NumericalInversion::NumericalInversion(const ContinuousDistribution &distribution, double resolution, INVERSION_INPUT inputFunction)
+    : uResolution(resolution), input(inputFunction)
+{
+    if (!(resolution >= 1e-14 && resolution <= 1e-5))
+        throw std::invalid_argument("Numerical inversion: resolution should lie in [1e-14, 1e-5]");
+    findDomain(distribution);
+
+    double x0 = lowerBoundary, h = (upperBoundary - lowerBoundary) / 64;
+    double uTotal = 0.0;
+    while (x0 < upperBoundary) {
+        if (intervals.size() >= MAX_INTERVALS)
+            throw std::runtime_error("Numerical inversion: too many intervals are needed for this resolution");
+        /// don't leave short remainder at the right end
+        double x1 = (x0 + 1.1 * h >= upperBoundary) ? upperBoundary : x0 + h;
+        h = x1 - x0;
+        if (h <= 1e-13 * std::fabs(x0) || h < MIN_POSITIVE)
+            throw std::runtime_error("Numerical inversion: quantile function can't be interpolated with this resolution");
+        Interval interval{};
+        double uLength = makeInterval(distribution, x0, h, interval);
+        if (uLength < 0) {
+            h *= 0.5;
+            continue;
+        }
+        /// intervals without probability are skipped
+        if (uLength > 0) {
+            interval.uStart = uTotal;
+            intervals.push_back(interval);
+            uTotal += uLength;
+        }
+        x0 = x1;
+        h *= 1.3;
+    }
+    if (intervals.empty())
+        throw std::invalid_argument("Numerical inversion: distribution should have positive density");
+    uMax = uTotal;
+    setupGuideTable();
+}
+
+void NumericalInversion::findDomain(const ContinuousDistribution &distribution)
+{
+    /// probability of the cut tails takes only a small part of the u-error,
+    /// finite boundaries are also cut, as density might vanish or be singular there
+    double tailProbability = 0.05 * uResolution;
+    lowerBoundary = distribution.Quantile(tailProbability);
+    if (!std::isfinite(lowerBoundary))
+        lowerBoundary = distribution.MinValue();
+    upperBoundary = distribution.Quantile1m(tailProbability);
+    if (!std::isfinite(upperBoundary))
+        upperBoundary = distribution.MaxValue();
+    /// quantile might be rounded to the pole of density
+    while (!std::isfinite(distribution.f(lowerBoundary)) && lowerBoundary < upperBoundary)
+        lowerBoundary = std::nextafter(lowerBoundary, upperBoundary);
+    while (!std::isfinite(distribution.f(upperBoundary)) && lowerBoundary < upperBoundary)
+        upperBoundary = std::nextafter(upperBoundary, lowerBoundary);
+    if (!(lowerBoundary < upperBoundary) || !std::isfinite(upperBoundary - lowerBoundary))
+        throw std::invalid_argument("Numerical inversion: tails of the distribution can't be cut");
+}
+
+double NumericalInversion::cdfIncrement(const ContinuousDistribution &distribution, double a, double b, bool lowerTail) const
+{
+    if (input == CDF_INPUT)
+        return lowerTail ? distribution.F(b) - distribution.F(a) : distribution.S(a) - distribution.S(b);
+    return RandMath::integral([&distribution] (double x)
+    {
+        return distribution.f(x);
+    }, a, b, 0.01 * uResolution, 20);
+}
+
+double NumericalInversion::makeInterval(const ContinuousDistribution &distribution, double x0, double h, Interval &interval) const
+{
+    bool lowerTail = (input == DENSITY_INPUT) || distribution.F(x0) < 0.5;
+    /// Chebyshev points of the interval, including both ends
+    double x[ORDER + 1], u[ORDER + 1];
+    x[0] = x0;
+    u[0] = 0.0;
+    for (int i = 1; i <= ORDER; ++i) {
+        x[i] = x0 + 0.5 * h * (1.0 - std::cos(M_PI * i / ORDER));
+        u[i] = u[i - 1] + cdfIncrement(distribution, x[i - 1], x[i], lowerTail);
+    }
+    if (u[ORDER] == 0.0)
+        return 0.0;
+    for (int i = 1; i <= ORDER; ++i) {
+        if (!(u[i] > u[i - 1]))
+            return -1.0;
+    }
+
+    /// divided differences of the inverse function
+    double c[ORDER + 1];
+    for (int i = 0; i <= ORDER; ++i)
+        c[i] = x[i] - x0;
+    for (int j = 1; j <= ORDER; ++j) {
+        for (int i = ORDER; i >= j; --i)
+            c[i] = (c[i] - c[i - 1]) / (u[i] - u[i - j]);
+    }
+    interval.x0 = x0;
+    for (int i = 0; i != ORDER - 1; ++i)
+        interval.z[i] = u[i + 1];
+    for (int i = 0; i != ORDER; ++i)
+        interval.c[i] = c[i + 1];
+
+    /// the largest u-errors are expected between the nodes, polynomial should also be monotone there,
+    /// points close to the ends catch the errors near poles of density
+    for (int i = 1; i <= ORDER; ++i) {
+        double xPrev = x[i - 1];
+        double uPrev = u[i - 1];
+        for (double weight : {1e-3, 0.25, 0.5, 0.75, 1 - 1e-3}) {
+            double t = u[i - 1] + weight * (u[i] - u[i - 1]);
+            double xt = evaluate(interval, t);
+            if (!(xt >= xPrev && xt <= x[i]))
+                return -1.0;
+            uPrev += cdfIncrement(distribution, xPrev, xt, lowerTail);
+            xPrev = xt;
+            if (std::fabs(uPrev - t) > 0.9 * uResolution)
+                return -1.0;
+        }
+    }
+    return u[ORDER];
+}
+
+double NumericalInversion::evaluate(const Interval &interval, double u)
+{
+    double p = interval.c[ORDER - 1];
+    for (int i = ORDER - 2; i >= 0; --i)
+        p = interval.c[i] + (u - interval.z[i]) * p;
+    return interval.x0 + u * p;
+}
+
+void NumericalInversion::setupGuideTable()
+{
+    size_t size = GUIDE_FACTOR * intervals.size();
+    guide.resize(size);
+    size_t i = 0;
+    for (size_t j = 0; j != size; ++j) {
+        double level = uMax * j / size;
+        while (i + 1 < intervals.size() && intervals[i + 1].uStart <= level)
+            ++i;
+        guide[j] = i;
+    }
+}
+
+double NumericalInversion::Quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0)
+        return NAN;
+    double u = p * uMax;
+    size_t size = intervals.size();
+    size_t i = guide[std::min(static_cast<size_t>(p * guide.size()), guide.size() - 1)];
+    while (i + 1 < size && intervals[i + 1].uStart <= u)
+        ++i;
+    /// p * size might be rounded up to the next level
+    while (i > 0 && intervals[i].uStart > u)
+        --i;
+    const Interval &interval = intervals[i];
+    double x = evaluate(interval, u - interval.uStart);
+    return std::min(std::max(x, lowerBoundary), upperBoundary);
+}
+
+double NumericalInversion::Variate() const
+{
+    return Quantile(UniformRand::StandardVariate(localRandGenerator));
+}
+
+void NumericalInversion::Sample(std::vector<double> &outputData) const
+{
+    localRandGenerator.FillUniform(outputData.data(), outputData.size());
+    for (double & var : outputData)
+        var = Quantile(var);
+}
+
+void NumericalInversion::Reseed(unsigned long seed) const
+{
+    localRandGenerator.Reseed(seed);
+}
+
+void NumericalInversion::ReseedStream(unsigned long long rootSeed, unsigned long long streamId) const
+{
+    localRandGenerator.ReseedStream(rootSeed, streamId);
+}
+
+void NumericalInversion::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+}
+
+void NumericalInversion::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+}
+
+void NumericalInversion::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+}
@@ -0,0 +1,159 @@
+#ifndef NUMERICALINVERSION_H
+#define NUMERICALINVERSION_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The NumericalInversion class <BR>
+ * Fast inversion of continuous distribution by interpolation of its quantile function (PINV)
+ *
+ * Quantile function is approximated by Newton polynomials on Chebyshev points,
+ * each interval is refined until the error in u-direction |F(Quantile(u)) - u| is below chosen resolution.
+ * Setup is made once for fixed parameters of the distribution, afterwards
+ * Quantile(), Variate() and Sample() cost O(1) and don't call the distribution anymore.
+ * Tails are cut where their probability is negligible compared to the resolution.
+ * Resolution can't be better than accuracy of f(x) or F(x), also poles of density
+ * contain too much probability within the last floating-point numbers for very small resolution.
+ *
+ * Reference: "Random variate generation by numerical inversion when only the density is known"
+ * by Gerhard Derflinger, Wolfgang Hörmann and Josef Leydold
+ */
+class RANDLIBSHARED_EXPORT NumericalInversion
+{
+public:
+    enum INVERSION_INPUT {
+        DENSITY_INPUT, ///< cdf is obtained by integration of f(x)
+        CDF_INPUT ///< cdf is obtained by F(x) and S(x)
+    };
+
+private:
+    static constexpr int ORDER = 5; ///< degree of interpolating polynomials
+    static constexpr size_t MAX_INTERVALS = 10000;
+    static constexpr size_t GUIDE_FACTOR = 4; ///< ratio of sizes of guide table and table of intervals
+
+    /// polynomial on one interval in Newton form:
+    /// x(u) = x0 + u * (c[0] + (u - z[0]) * (c[1] + ... + (u - z[ORDER - 2]) * c[ORDER - 1]))
+    struct Interval {
+        double uStart; ///< cumulative probability of the left end
+        double x0; ///< left end
+        double z[ORDER - 1]; ///< inner interpolation nodes in u-direction
+        double c[ORDER]; ///< divided differences
+    };
+
+    std::vector<Interval> intervals{};
+    std::vector<size_t> guide{}; ///< guide table for search of the interval
+    double uMax = 1; ///< total probability of the interpolated domain
+    double lowerBoundary = 0, upperBoundary = 0;
+    double uResolution = 1e-10;
+    INVERSION_INPUT input = DENSITY_INPUT;
+
+    mutable RandGenerator localRandGenerator{};
+
+public:
+    /**
+     * @fn NumericalInversion
+     * @param distribution one, which is going to be inverted, is used only during the setup
+     * @param resolution maximal error in u-direction, should lie in [1e-14, 1e-5]
+     * @param inputFunction f(x) or F(x) as a source of the quantile function
+     */
+    explicit NumericalInversion(const ContinuousDistribution &distribution, double resolution = 1e-10, INVERSION_INPUT inputFunction = DENSITY_INPUT);
+
+    /**
+     * @fn Quantile
+     * @param p
+     * @return approximation of quantile of the distribution, monotone in p,
+     * can be used with quasi-random input
+     */
+    double Quantile(double p) const;
+    /**
+     * @fn Variate
+     * @return random variate, obtained by inversion
+     */
+    double Variate() const;
+    /**
+     * @fn Sample
+     * @param outputData
+     */
+    void Sample(std::vector<double> &outputData) const;
+    /**
+     * @brief Reseed
+     * @param seed
+     */
+    void Reseed(unsigned long seed) const;
+    /**
+     * @fn ReseedStream
+     * start independent stream streamId of the generator, seeded by rootSeed
+     * @param rootSeed
+     * @param streamId
+     */
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId) const;
+    /**
+     * @fn SetEngine
+     * use engine of the same type as prototype, freshly seeded
+     * @param prototype
+     */
+    void SetEngine(const RandGenerator &prototype) const;
+    /**
+     * @fn SaveState
+     * store state of the generator in binary form
+     * @param outputStream
+     */
+    void SaveState(std::ostream &outputStream) const;
+    /**
+     * @fn LoadState
+     * restore state of the generator, stored by SaveState
+     * @param inputStream
+     */
+    void LoadState(std::istream &inputStream) const;
+
+    /**
+     * @fn GetResolution
+     * @return maximal error in u-direction
+     */
+    inline double GetResolution() const { return uResolution; }
+    /**
+     * @fn GetNumberOfIntervals
+     * @return size of the table
+     */
+    inline size_t GetNumberOfIntervals() const { return intervals.size(); }
+
+private:
+    /**
+     * @fn findDomain
+     * set boundaries of interpolation, cutting tails of negligible probability
+     * @param distribution
+     */
+    void findDomain(const ContinuousDistribution &distribution);
+    /**
+     * @fn cdfIncrement
+     * @param distribution
+     * @param a
+     * @param b
+     * @param lowerTail true if F(x) is more accurate than S(x) at these points
+     * @return P(a < X < b)
+     */
+    double cdfIncrement(const ContinuousDistribution &distribution, double a, double b, bool lowerTail) const;
+    /**
+     * @fn makeInterval
+     * interpolate quantile function on [x0, x0 + h] and check u-error
+     * @param distribution
+     * @param x0 left end
+     * @param h length of the interval
+     * @param interval output polynomial with zero uStart
+     * @return probability of the interval if u-error is fine, negative value otherwise
+     */
+    double makeInterval(const ContinuousDistribution &distribution, double x0, double h, Interval &interval) const;
+    /**
+     * @fn evaluate
+     * @param interval
+     * @param u probability, counted from the left end of the interval
+     * @return value of the polynomial
+     */
+    static double evaluate(const Interval &interval, double u);
+    /**
+     * @fn setupGuideTable
+     */
+    void setupGuideTable();
+};
+
+#endif // NUMERICALINVERSION_H
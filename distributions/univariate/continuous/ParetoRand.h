@@ -47,6 +47,7 @@ private:
 public:
     double Variate() const override;
     static double StandardVariate(double shape, RandGenerator &randGenerator = staticRandGenerator);
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
 
     double Mean() const override;
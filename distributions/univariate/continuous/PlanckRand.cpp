@@ -107,6 +107,30 @@ void PlanckRand::Sample(std::vector<double> &outputData) const
         var /= Z.Variate();
 }
 
+void PlanckRand::Reseed(unsigned long seed) const
+{
+    G.Reseed(seed);
+    Z.Reseed(seed + 1);
+}
+
+void PlanckRand::SetEngine(const RandGenerator &prototype) const
+{
+    G.SetEngine(prototype);
+    Z.SetEngine(prototype);
+}
+
+void PlanckRand::SaveState(std::ostream &outputStream) const
+{
+    G.SaveState(outputStream);
+    Z.SaveState(outputStream);
+}
+
+void PlanckRand::LoadState(std::istream &inputStream) const
+{
+    G.LoadState(inputStream);
+    Z.LoadState(inputStream);
+}
+
 double PlanckRand::Mean() const
 {
     double y = (a + 1) / b;
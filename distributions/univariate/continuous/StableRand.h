@@ -344,6 +344,7 @@ private:
     double variateForExponentEqualOneHalf() const;
 public:
     double Variate() const override;
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
 
 public:
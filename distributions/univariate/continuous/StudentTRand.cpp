@@ -155,6 +155,24 @@ void StudentTRand::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+void StudentTRand::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    Y.SetEngine(prototype);
+}
+
+void StudentTRand::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    Y.SaveState(outputStream);
+}
+
+void StudentTRand::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    Y.LoadState(inputStream);
+}
+
 double StudentTRand::Mean() const
 {
     return (nu > 1) ? mu : NAN;
@@ -0,0 +1,268 @@
+#include "TransformedDensityRejection.h"
+#include "UniformRand.h"
+#include "ExponentialRand.h"
+
+TransformedDensityRejection::TransformedDensityRejection(const ContinuousDistribution &logConcaveDistribution, double maxRatio, size_t maxPoints)
+    : distribution(logConcaveDistribution), minValue(logConcaveDistribution.MinValue()), maxValue(logConcaveDistribution.MaxValue())
+{
+    if (!(maxRatio > 1.0))
+        throw std::invalid_argument("Transformed density rejection: ratio of hat and squeeze should be larger than 1");
+    maxPoints = std::max(maxPoints, MIN_POINTS);
+
+    /// initial points are spread over the bulk of the distribution,
+    /// logarithm of density is shifted by its largest value among them
+    double logMax = -INFINITY;
+    for (double p : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        double x = distribution.Quantile(p);
+        double y = std::isfinite(x) ? distribution.logf(x) : NAN;
+        if (std::isfinite(y)) {
+            points.push_back(x);
+            logDensity.push_back(y);
+            logMax = std::max(logMax, y);
+        }
+    }
+    for (size_t i = 1; i < points.size(); ++i) {
+        if (points[i] <= points[i - 1]) {
+            points.erase(points.begin() + i);
+            logDensity.erase(logDensity.begin() + i);
+            --i;
+        }
+    }
+    if (points.size() < MIN_POINTS)
+        throw std::invalid_argument("Transformed density rejection: density should be positive and continuous");
+    logShift = logMax;
+    for (double & y : logDensity)
+        y -= logShift;
+
+    size_t interval = buildHat();
+    while (hatArea > maxRatio * squeezeArea && points.size() < maxPoints) {
+        if (!addPoint(newPoint(interval)))
+            break;
+        interval = buildHat();
+    }
+    setupGuideTable();
+}
+
+bool TransformedDensityRejection::addPoint(double x)
+{
+    if (!std::isfinite(x) || x <= minValue || x >= maxValue)
+        return false;
+    auto it = std::lower_bound(points.begin(), points.end(), x);
+    if (it != points.end() && *it == x)
+        return false;
+    double y = distribution.logf(x) - logShift;
+    if (!std::isfinite(y))
+        return false;
+    logDensity.insert(logDensity.begin() + (it - points.begin()), y);
+    points.insert(it, x);
+    return true;
+}
+
+size_t TransformedDensityRejection::buildHat()
+{
+    size_t n = points.size();
+    std::vector<double> slope(n - 1);
+    for (size_t i = 0; i != n - 1; ++i) {
+        slope[i] = (logDensity[i + 1] - logDensity[i]) / (points[i + 1] - points[i]);
+        /// rounding errors are tolerated for the linear parts of log(f(x))
+        if (i > 0 && slope[i] > slope[i - 1] + 1e-10 * (1.0 + std::fabs(slope[i - 1])))
+            throw std::invalid_argument("Transformed density rejection: density should be log-concave");
+    }
+    if ((minValue == -INFINITY && !(slope[0] > 0)) || (maxValue == INFINITY && !(slope[n - 2] < 0)))
+        throw std::invalid_argument("Transformed density rejection: tails of log-concave density should decrease");
+
+    pieces.clear();
+    auto addPiece = [this] (double left, double right, double x, double y, double s, double sqX, double sqY, double sqSlope)
+    {
+        if (!(left < right))
+            return 0.0;
+        Piece piece = {left, right, x, y, s, sqX, sqY, sqSlope, 0.0, 0.0};
+        piece.area = pieceArea(piece);
+        if (std::isfinite(left) && std::isfinite(right))
+            piece.expm1Width = std::expm1(-std::fabs(s) * (right - left));
+        pieces.push_back(piece);
+        return piece.area;
+    };
+
+    /// areas are accumulated for each interval between construction points,
+    /// the refinement goes to the one with the largest difference between hat and squeeze
+    hatArea = squeezeArea = 0.0;
+    size_t worstInterval = 0;
+    double worstDifference = -1.0;
+    auto checkInterval = [&] (size_t index, double hat, double squeeze)
+    {
+        hatArea += hat;
+        squeezeArea += squeeze;
+        if (hat - squeeze > worstDifference) {
+            worstDifference = hat - squeeze;
+            worstInterval = index;
+        }
+    };
+
+    /// left tail
+    double hat = addPiece(minValue, points[0], points[0], logDensity[0], slope[0], 0, -INFINITY, 0);
+    checkInterval(0, hat, 0.0);
+
+    for (size_t k = 1; k != n; ++k) {
+        double x0 = points[k - 1], x1 = points[k];
+        double y0 = logDensity[k - 1], y1 = logDensity[k];
+        /// squeeze is the chord, hat is the minimum of the neighbour chords extended inside
+        Piece chord = {x0, x1, x0, y0, slope[k - 1], 0, 0, 0, 0.0, 0.0};
+        double squeeze = pieceArea(chord);
+        bool hasLeft = (k >= 2), hasRight = (k + 1 < n);
+        if (hasLeft && hasRight && slope[k - 2] > slope[k]) {
+            /// intersection of the lines, the left one is lower at x0 and the right one is lower at x1
+            double rightAtX0 = y1 - slope[k] * (x1 - x0);
+            double t = x0 + (rightAtX0 - y0) / (slope[k - 2] - slope[k]);
+            t = std::min(std::max(t, x0), x1);
+            hat = addPiece(x0, t, x0, y0, slope[k - 2], x0, y0, slope[k - 1]);
+            hat += addPiece(t, x1, x1, y1, slope[k], x0, y0, slope[k - 1]);
+        }
+        else if (hasLeft)
+            hat = addPiece(x0, x1, x0, y0, slope[k - 2], x0, y0, slope[k - 1]);
+        else if (hasRight)
+            hat = addPiece(x0, x1, x1, y1, slope[k], x0, y0, slope[k - 1]);
+        else
+            hat = addPiece(x0, x1, x0, y0, slope[k - 1], x0, y0, slope[k - 1]);
+        checkInterval(k, hat, squeeze);
+    }
+
+    /// right tail
+    hat = addPiece(points[n - 1], maxValue, points[n - 1], logDensity[n - 1], slope[n - 2], 0, -INFINITY, 0);
+    checkInterval(n, hat, 0.0);
+
+    if (!std::isfinite(hatArea) || !(squeezeArea > 0))
+        throw std::invalid_argument("Transformed density rejection: hat can't be normalized");
+    return worstInterval;
+}
+
+double TransformedDensityRejection::newPoint(size_t interval) const
+{
+    size_t n = points.size();
+    /// median of the exponential hat in the tail, for finite end it is kept in the closer half of the interval,
+    /// and if the hat doesn't decrease towards the end, the interval is split in the middle
+    if (interval == 0) {
+        double slope = (logDensity[1] - logDensity[0]) / (points[1] - points[0]);
+        double x = points[0] - M_LN2 / slope;
+        if (minValue == -INFINITY)
+            return x;
+        double middle = 0.5 * (minValue + points[0]);
+        return (x < points[0]) ? std::max(x, middle) : middle;
+    }
+    if (interval == n) {
+        double slope = (logDensity[n - 1] - logDensity[n - 2]) / (points[n - 1] - points[n - 2]);
+        double x = points[n - 1] - M_LN2 / slope;
+        if (maxValue == INFINITY)
+            return x;
+        double middle = 0.5 * (points[n - 1] + maxValue);
+        return (x > points[n - 1]) ? std::min(x, middle) : middle;
+    }
+    return 0.5 * (points[interval - 1] + points[interval]);
+}
+
+double TransformedDensityRejection::pieceArea(const Piece &piece)
+{
+    double s = piece.hatSlope;
+    if (!std::isfinite(piece.left))
+        return std::exp(piece.hatY + s * (piece.right - piece.hatX)) / s;
+    if (!std::isfinite(piece.right))
+        return -std::exp(piece.hatY + s * (piece.left - piece.hatX)) / s;
+    double width = piece.right - piece.left;
+    if (s == 0.0)
+        return std::exp(piece.hatY) * width;
+    /// exponent is taken at the end with larger hat
+    if (s > 0)
+        return -std::exp(piece.hatY + s * (piece.right - piece.hatX)) * std::expm1(-s * width) / s;
+    return std::exp(piece.hatY + s * (piece.left - piece.hatX)) * std::expm1(s * width) / s;
+}
+
+double TransformedDensityRejection::inversePiece(const Piece &piece, double p)
+{
+    double s = piece.hatSlope;
+    if (!std::isfinite(piece.left))
+        return piece.right + std::log(p) / s;
+    if (!std::isfinite(piece.right))
+        return piece.left + std::log(p) / s;
+    double x = piece.left + p * (piece.right - piece.left);
+    if (s > 0)
+        x = piece.right + std::log1p((1.0 - p) * piece.expm1Width) / s;
+    else if (s < 0)
+        x = piece.left + std::log1p(p * piece.expm1Width) / s;
+    return std::min(std::max(x, piece.left), piece.right);
+}
+
+void TransformedDensityRejection::setupGuideTable()
+{
+    size_t size = pieces.size();
+    cumulativeArea.resize(size);
+    double sum = 0.0;
+    for (size_t i = 0; i != size; ++i) {
+        cumulativeArea[i] = sum;
+        sum += pieces[i].area;
+    }
+    hatArea = sum;
+    guide.resize(size);
+    size_t i = 0;
+    for (size_t j = 0; j != size; ++j) {
+        double level = hatArea * j / size;
+        while (i + 1 < size && cumulativeArea[i + 1] <= level)
+            ++i;
+        guide[j] = i;
+    }
+}
+
+double TransformedDensityRejection::Variate() const
+{
+    size_t size = pieces.size();
+    for (int iter = 0; iter != MAX_ITER_REJECTION; ++iter) {
+        double U = UniformRand::StandardVariate(localRandGenerator);
+        double area = U * hatArea;
+        size_t i = guide[std::min(static_cast<size_t>(U * size), size - 1)];
+        while (i + 1 < size && cumulativeArea[i + 1] <= area)
+            ++i;
+        const Piece &piece = pieces[i];
+        /// uniform is reused for the position inside the piece
+        double p = (area - cumulativeArea[i]) / piece.area;
+        if (!(p > 0.0 && p <= 1.0))
+            continue;
+        double x = inversePiece(piece, p);
+        double E = ExponentialRand::StandardVariate(localRandGenerator);
+        double level = piece.hatY + piece.hatSlope * (x - piece.hatX) - E;
+        if (level <= piece.squeezeY + piece.squeezeSlope * (x - piece.squeezeX))
+            return x;
+        if (level <= distribution.logf(x) - logShift)
+            return x;
+    }
+    return NAN;
+}
+
+void TransformedDensityRejection::Sample(std::vector<double> &outputData) const
+{
+    for (double & var : outputData)
+        var = Variate();
+}
+
+void TransformedDensityRejection::Reseed(unsigned long seed) const
+{
+    localRandGenerator.Reseed(seed);
+}
+
+void TransformedDensityRejection::ReseedStream(unsigned long long rootSeed, unsigned long long streamId) const
+{
+    localRandGenerator.ReseedStream(rootSeed, streamId);
+}
+
+void TransformedDensityRejection::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+}
+
+void TransformedDensityRejection::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+}
+
+void TransformedDensityRejection::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+}
@@ -0,0 +1,150 @@
+#ifndef TRANSFORMEDDENSITYREJECTION_H
+#define TRANSFORMEDDENSITYREJECTION_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The TransformedDensityRejection class <BR>
+ * Automatic rejection sampler for any log-concave continuous distribution
+ *
+ * Hat and squeeze are piecewise exponential functions: logarithm of density is bounded by lines,
+ * which go through construction points. Chord between two neighbour points lies below log(f(x))
+ * between them and above outside, hence hat and squeeze need no derivative.
+ * Construction points are added during the setup until the ratio of areas below hat and squeeze
+ * reaches chosen bound, afterwards the sampler is fixed and
+ * log(f(x)) is evaluated only if the squeeze test fails.
+ *
+ * Distribution should outlive the sampler.
+ *
+ * Reference: "Derivative-free adaptive rejection sampling for Gibbs sampling" by W.R. Gilks
+ */
+class RANDLIBSHARED_EXPORT TransformedDensityRejection
+{
+    /// part of the hat with linear logarithm
+    struct Piece {
+        double left, right; ///< boundaries
+        double hatX, hatY, hatSlope; ///< log of hat is hatY + hatSlope * (x - hatX)
+        double squeezeX, squeezeY, squeezeSlope; ///< the same for squeeze, squeezeY = -∞ if there is no squeeze
+        double area; ///< area below the hat
+        double expm1Width; ///< exp(-|hatSlope| * width) - 1 for finite pieces, used in inversion
+    };
+
+    static constexpr size_t MIN_POINTS = 3;
+    static constexpr int MAX_ITER_REJECTION = 1000;
+
+    const ContinuousDistribution &distribution;
+    double minValue, maxValue; ///< support
+    double logShift = 0; ///< maximum of log(f(x)) at initial construction points, subtracted to avoid overflow
+
+    std::vector<double> points{}; ///< construction points in ascending order
+    std::vector<double> logDensity{}; ///< shifted log(f(x)) at construction points
+    std::vector<Piece> pieces{};
+    std::vector<double> cumulativeArea{}; ///< area below the hat on the left of each piece
+    std::vector<size_t> guide{}; ///< guide table for search of the piece
+    double hatArea = 0, squeezeArea = 0;
+
+    mutable RandGenerator localRandGenerator{};
+
+public:
+    /**
+     * @fn TransformedDensityRejection
+     * @param logConcaveDistribution distribution with log-concave density
+     * @param maxRatio setup stops when area below hat doesn't exceed area below squeeze more than in maxRatio times
+     * @param maxPoints upper bound for number of construction points
+     * @note maxRatio might be not reached if maxPoints is too small or new points can't be added
+     * due to the rounding errors, use GetRatio() to check the achieved ratio
+     */
+    explicit TransformedDensityRejection(const ContinuousDistribution &logConcaveDistribution, double maxRatio = 1.05, size_t maxPoints = 100);
+
+    /**
+     * @fn Variate
+     * @return random variate or NaN if rejection failed
+     */
+    double Variate() const;
+    /**
+     * @fn Sample
+     * @param outputData
+     */
+    void Sample(std::vector<double> &outputData) const;
+    /**
+     * @brief Reseed
+     * @param seed
+     */
+    void Reseed(unsigned long seed) const;
+    /**
+     * @fn ReseedStream
+     * set the generator to the beginning of the stream with given id, derived from the root seed
+     * @param rootSeed
+     * @param streamId
+     */
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId) const;
+    /**
+     * @fn SetEngine
+     * switch the generator to new randomly seeded engine of the same type as in prototype
+     * @param prototype
+     */
+    void SetEngine(const RandGenerator &prototype) const;
+    /**
+     * @fn SaveState
+     * write binary state of the generator, so that sampling can be resumed by LoadState
+     * @param outputStream
+     */
+    void SaveState(std::ostream &outputStream) const;
+    /**
+     * @fn LoadState
+     * read binary state, written by SaveState of the sampler with the same engine
+     * @param inputStream
+     */
+    void LoadState(std::istream &inputStream) const;
+
+    /**
+     * @fn GetNumberOfPoints
+     * @return number of construction points
+     */
+    inline size_t GetNumberOfPoints() const { return points.size(); }
+    /**
+     * @fn GetRatio
+     * @return ratio of areas below hat and squeeze, expected number of iterations doesn't exceed it
+     */
+    inline double GetRatio() const { return hatArea / squeezeArea; }
+
+private:
+    /**
+     * @fn addPoint
+     * insert construction point, keeping the order
+     * @param x
+     * @return true if log(f(x)) is finite and x is new
+     */
+    bool addPoint(double x);
+    /**
+     * @fn buildHat
+     * make pieces of hat and squeeze for current construction points
+     * @return index of the interval between points (0 and points.size() for tails) with the largest area between hat and squeeze
+     */
+    size_t buildHat();
+    /**
+     * @fn newPoint
+     * @param interval index of the interval, returned by buildHat()
+     * @return construction point, which splits the interval
+     */
+    double newPoint(size_t interval) const;
+    /**
+     * @fn setupGuideTable
+     */
+    void setupGuideTable();
+    /**
+     * @fn pieceArea
+     * @param piece
+     * @return integral of exp(hat(x)) over the piece
+     */
+    static double pieceArea(const Piece &piece);
+    /**
+     * @fn inversePiece
+     * @param piece
+     * @param p probability in (0, 1]
+     * @return quantile of the hat, restricted to the piece
+     */
+    static double inversePiece(const Piece &piece, double p);
+};
+
+#endif // TRANSFORMEDDENSITYREJECTION_H
@@ -35,49 +35,36 @@ double UniformRand::S(const double & x) const
     return (x > b) ? 0.0 : bmaInv * (b - x);
 }
 
+void UniformRand::SetConversion(UNIFORM_INTERVAL uniformInterval, UNIFORM_RESOLUTION uniformResolution)
+{
+    interval = uniformInterval;
+    resolution = uniformResolution;
+}
+
 double UniformRand::Variate() const
 {
-    return a + StandardVariate(localRandGenerator) * bma;
-}
-
-double UniformRand::StandardVariate(RandGenerator &randGenerator)
-{
-#ifdef RANDLIB_UNIDBL
-    /// generates a random number on [0,1) with 53-bit resolution, using 2 32-bit integer variate
-    double x;
-    unsigned int a, b;
-    a = randGenerator.Variate() >> 6; /// Upper 26 bits
-    b = randGenerator.Variate() >> 5; /// Upper 27 bits
-    x = (a * 134217728.0 + b) / 9007199254740992.0;
-    return x;
-#elif defined(RANDLIB_JLKISS64)
-    /// generates a random number on [0,1) with 53-bit resolution, using 64-bit integer variate
-    double x;
-    unsigned long long a = randGenerator.Variate();
-    a = (a >> 12) | 0x3FF0000000000000ULL; /// Take upper 52 bit
-    *(reinterpret_cast<unsigned long long *>(&x)) = a; /// Make a double from bits
-    return x - 1.0;
-#elif defined(RANDLIB_UNICLOSED)
-    /// generates a random number on interval [0,1]
-    double x = randGenerator.Variate();
-    return x / 4294967295.0;
-#elif defined(RANDLIB_UNIHALFCLOSED)
-    /// generates a random number on interval [0,1)
-    double x = randGenerator.Variate();
-    return x / 4294967296.0;
-#else
-    /// generates a random number on interval (0,1)
-    double x = randGenerator.Variate();
-    x += 0.5;
-    x /= 4294967296.0;
-    return x;
-#endif
+    return a + StandardVariate(interval, resolution, localRandGenerator) * bma;
 }
 
 void UniformRand::Sample(std::vector<double> &outputData) const
 {
+    localRandGenerator.FillUniform(outputData.data(), outputData.size(), interval, resolution);
     for (double & var : outputData)
-        var = this->Variate();
+        var = a + var * bma;
+}
+
+void UniformRand::Sample(std::vector<float> &outputData) const
+{
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    unsigned int W[blockSize];
+    const float lower = a, width = bma;
+    size_t size = outputData.size();
+    for (size_t i = 0; i < size; i += blockSize) {
+        size_t n = std::min(size - i, blockSize);
+        localRandGenerator.Fill32(W, n);
+        for (size_t j = 0; j != n; ++j)
+            outputData[i + j] = lower + width * UniformConversion::FromBits24(W[j] >> 8, interval);
+    }
 }
 
 double UniformRand::Mean() const
@@ -17,12 +17,25 @@
  */
 class RANDLIBSHARED_EXPORT UniformRand : public BetaDistribution
 {
+    UNIFORM_INTERVAL interval = DEFAULT_UNIFORM_INTERVAL;
+    UNIFORM_RESOLUTION resolution = DEFAULT_UNIFORM_RESOLUTION;
+
 public:
     UniformRand(double minValue = 0, double maxValue = 1);
     String Name() const override;
 
     using BetaDistribution::SetSupport;
 
+    /**
+     * @fn SetConversion
+     * set interval and resolution of standard uniform variates, used by Variate() and Sample()
+     * @param uniformInterval
+     * @param uniformResolution
+     */
+    void SetConversion(UNIFORM_INTERVAL uniformInterval, UNIFORM_RESOLUTION uniformResolution);
+    inline UNIFORM_INTERVAL GetInterval() const { return interval; }
+    inline UNIFORM_RESOLUTION GetResolution() const { return resolution; }
+
     SUPPORT_TYPE SupportType() const override { return FINITE_T; }
     double MinValue() const override { return a; }
     double MaxValue() const override { return b; }
@@ -33,7 +46,16 @@ public:
     double S(const double & x) const override;
     double Variate() const override;
     static double StandardVariate(RandGenerator &randGenerator = staticRandGenerator);
+    static double StandardVariate(UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution, RandGenerator &randGenerator = staticRandGenerator);
+    using ContinuousDistribution::Sample;
     void Sample(std::vector<double> &outputData) const override;
+    /**
+     * @fn Sample
+     * fill vector by variates in single precision with 24 random bits,
+     * resolution of the conversion applies to double precision only
+     * @param outputData
+     */
+    void Sample(std::vector<float> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -77,4 +99,14 @@ public:
     void Fit(const std::vector<double> &sample, bool unbiased = false);
 };
 
+inline double UniformRand::StandardVariate(RandGenerator &randGenerator)
+{
+    return randGenerator.UniformVariate();
+}
+
+inline double UniformRand::StandardVariate(UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution, RandGenerator &randGenerator)
+{
+    return randGenerator.UniformVariate(interval, resolution);
+}
+
 #endif // UNIFORMRAND_H
@@ -62,6 +62,21 @@ void WignerSemicircleRand::Reseed(unsigned long seed) const
     X.Reseed(seed);
 }
 
+void WignerSemicircleRand::SetEngine(const RandGenerator &prototype) const
+{
+    X.SetEngine(prototype);
+}
+
+void WignerSemicircleRand::SaveState(std::ostream &outputStream) const
+{
+    X.SaveState(outputStream);
+}
+
+void WignerSemicircleRand::LoadState(std::istream &inputStream) const
+{
+    X.LoadState(inputStream);
+}
+
 double WignerSemicircleRand::Mean() const
 {
     return 0.0;
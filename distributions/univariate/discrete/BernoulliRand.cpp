@@ -52,13 +52,12 @@ int BernoulliRand::Variate(double probability, RandGenerator &randGenerator)
 
 int BernoulliRand::StandardVariate(RandGenerator &randGenerator)
 {
-    static const size_t maxDecimals = randGenerator.maxDecimals();
     static size_t decimals = 1;
     static unsigned long long X = 0;
     if (decimals == 1)
     {
         /// refresh
-        decimals = maxDecimals;
+        decimals = randGenerator.maxDecimals();
         X = randGenerator.Variate();
     }
     else
@@ -81,7 +80,48 @@ void BernoulliRand::Sample(std::vector<int> &outputData) const
     }
 }
 
+template <typename IntType>
+void BernoulliRand::sampleNarrow(std::vector<IntType> &outputData) const
+{
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    unsigned int W[blockSize];
+    size_t size = outputData.size();
+    if (p == 0.5) {
+        for (size_t i = 0; i < size; i += 32 * blockSize) {
+            size_t length = std::min(size - i, 32 * blockSize);
+            localRandGenerator.Fill32(W, (length + 31) / 32);
+            for (size_t j = 0; j != length; ++j)
+                outputData[i + j] = (W[j / 32] >> (j & 31)) & 1;
+        }
+        return;
+    }
+    const unsigned int boundary32 = q * 4294967295.0;
+    for (size_t i = 0; i < size; i += blockSize) {
+        size_t length = std::min(size - i, blockSize);
+        localRandGenerator.Fill32(W, length);
+        for (size_t j = 0; j != length; ++j)
+            outputData[i + j] = W[j] > boundary32;
+    }
+}
+
+void BernoulliRand::Sample(std::vector<uint8_t> &outputData) const
+{
+    sampleNarrow(outputData);
+}
+
+void BernoulliRand::Sample(std::vector<uint16_t> &outputData) const
+{
+    sampleNarrow(outputData);
+}
+
 double BernoulliRand::Entropy()
 {
     return -(p * logProb + q * log1mProb);
 }
+
+void BernoulliRand::SetEngine(const RandGenerator &prototype) const
+{
+    BinomialDistribution::SetEngine(prototype);
+    /// boundary depends on the range of the engine
+    boundary = q * localRandGenerator.MaxValue();
+}
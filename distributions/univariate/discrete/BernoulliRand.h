@@ -18,7 +18,10 @@
  */
 class RANDLIBSHARED_EXPORT BernoulliRand : public BinomialDistribution
 {
-    unsigned long long boundary = 0;///< coefficient for faster random number generation
+    mutable unsigned long long boundary = 0;///< coefficient for faster random number generation
+
+    template <typename IntType>
+    void sampleNarrow(std::vector<IntType> &outputData) const;
 
 public:
     explicit BernoulliRand(double probability = 0.5);
@@ -35,6 +38,15 @@ public:
     static int Variate(double probability, RandGenerator &randGenerator = staticRandGenerator);
     static int StandardVariate(RandGenerator &randGenerator = staticRandGenerator);
     void Sample(std::vector<int> &outputData) const override;
+    /**
+     * @fn Sample
+     * narrow versions, made of 32-bit words directly:
+     * one word gives 32 variates for p = 0.5 and one variate otherwise
+     * @param outputData
+     */
+    void Sample(std::vector<uint8_t> &outputData) const;
+    void Sample(std::vector<uint16_t> &outputData) const;
+    void SetEngine(const RandGenerator &prototype) const override;
 
     inline double Entropy();
 };
@@ -25,6 +25,7 @@ void BetaBinomialRand::SetParameters(int number, double shape1, double shape2)
     pmfCoef = RandMath::lfact(n);
     pmfCoef -= std::lgamma(B.GetAlpha() + B.GetBeta() + n);
     pmfCoef -= B.GetLogBetaFunction();
+    guideTable = GuideTableSetup();
 }
 
 double BetaBinomialRand::P(const int & k) const
@@ -63,12 +64,36 @@ int BetaBinomialRand::Variate() const
     return BinomialDistribution::Variate(n, p, localRandGenerator);
 }
 
+void BetaBinomialRand::Sample(std::vector<int> &outputData) const
+{
+    if (!sampleByGuideTable(outputData, guideTable))
+        DiscreteDistribution::Sample(outputData);
+}
+
 void BetaBinomialRand::Reseed(unsigned long seed) const
 {
     localRandGenerator.Reseed(seed);
     B.Reseed(seed + 1);
 }
 
+void BetaBinomialRand::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    B.SetEngine(prototype);
+}
+
+void BetaBinomialRand::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    B.SaveState(outputStream);
+}
+
+void BetaBinomialRand::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    B.LoadState(inputStream);
+}
+
 double BetaBinomialRand::Mean() const
 {
     double alpha = B.GetAlpha();
@@ -19,6 +19,7 @@ class RANDLIBSHARED_EXPORT BetaBinomialRand : public DiscreteDistribution
     int n = 1; ///< number of experiments
     double pmfCoef = 0; ///< log(n!) - log(Γ(α + β + n)) - log(B(α, β))
     BetaRand B{};
+    mutable GuideTableSetup guideTable{}; ///< table for long samples, built on demand
 
 public:
     BetaBinomialRand(int number, double shape1, double shape2);
@@ -36,7 +37,11 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
+    void SaveState(std::ostream &outputStream) const override;
+    void LoadState(std::istream &inputStream) const override;
 
     double Mean() const override;
     double Variance() const override;
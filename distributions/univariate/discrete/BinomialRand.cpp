@@ -4,6 +4,28 @@
 #include "../continuous/ExponentialRand.h"
 #include "BernoulliRand.h"
 
+namespace
+{
+
+/**
+ * @fn stirlingCorrection
+ * @param k
+ * @return log(k!) - (k + 1/2) log(k + 1) + (k + 1) - log(2π) / 2
+ */
+double stirlingCorrection(int k)
+{
+    static constexpr double table[10] = {
+        0.08106146679532726, 0.04134069595540929, 0.02767792568499834, 0.02079067210376509, 0.01664469118982119,
+        0.01387612882307075, 0.01189670994589177, 0.01041126526197209, 0.009255462182712733, 0.008330563433362871
+    };
+    if (k < 10)
+        return table[k];
+    double kp1Inv = 1.0 / (k + 1), kp1InvSq = kp1Inv * kp1Inv;
+    return (1.0 / 12 - (1.0 / 360 - kp1InvSq / 1260) * kp1InvSq) * kp1Inv;
+}
+
+}
+
 BinomialDistribution::BinomialDistribution(int number, double probability)
 {
     SetParameters(number, probability);
@@ -231,16 +253,6 @@ int BinomialDistribution::variateWaiting(int number) const
     return X;
 }
 
-int BinomialDistribution::variateWaiting(int number, double probability, RandGenerator &randGenerator)
-{
-    int X = -1, sum = 0;
-    do {
-        sum += GeometricRand::Variate(probability, randGenerator) + 1;
-        ++X;
-    } while (sum <= number);
-    return X;
-}
-
 int BinomialDistribution::variateBernoulliSum(int number, double probability, RandGenerator &randGenerator)
 {
     int var = 0;
@@ -255,6 +267,91 @@ int BinomialDistribution::variateBernoulliSum(int number, double probability, Ra
     return var;
 }
 
+int BinomialDistribution::variateInversion(int number, double probability, RandGenerator &randGenerator)
+{
+    double U = UniformRand::StandardVariate(randGenerator);
+    double r = probability / (1.0 - probability);
+    double P = std::exp(number * std::log1p(-probability)), s = P;
+    int k = 0;
+    while (s < U && k < number) {
+        ++k;
+        P *= r * (number - k + 1) / k;
+        s += P;
+    }
+    return k;
+}
+
+int BinomialDistribution::variateTransformedRejection(int number, double probability, RandGenerator &randGenerator)
+{
+    double q = 1.0 - probability;
+    double npq = number * probability * q;
+    double sqrtNpq = std::sqrt(npq);
+    int m = std::floor((number + 1) * probability);
+    double r = probability / q;
+    double nr = (number + 1) * r;
+    double b = 1.15 + 2.53 * sqrtNpq;
+    double a = -0.0873 + 0.0248 * b + 0.01 * probability;
+    double c = number * probability + 0.5;
+    double alpha = (2.83 + 5.1 / b) * sqrtNpq;
+    double vr = 0.92 - 4.2 / b;
+    double urvr = 0.86 * vr;
+    int iter = 0;
+    do {
+        double V = UniformRand::StandardVariate(randGenerator);
+        /// immediate acceptance in the centre of the hat
+        if (V <= urvr) {
+            double U = V / vr - 0.43;
+            return std::floor((2 * a / (0.5 - std::fabs(U)) + b) * U + c);
+        }
+        double U;
+        if (V >= vr) {
+            U = UniformRand::StandardVariate(randGenerator) - 0.5;
+        }
+        else {
+            U = V / vr - 0.93;
+            U = ((U > 0) ? 0.5 : -0.5) - U;
+            V = UniformRand::StandardVariate(randGenerator) * vr;
+        }
+        double us = 0.5 - std::fabs(U);
+        double X = std::floor((2 * a / us + b) * U + c);
+        if (X < 0 || X > number)
+            continue;
+        int k = X;
+        V *= alpha / (a / (us * us) + b);
+        int km = std::abs(k - m);
+        if (km <= 15) {
+            /// recursive evaluation of the ratio P(k) / P(m)
+            double f = 1.0;
+            if (m < k) {
+                for (int i = m + 1; i <= k; ++i)
+                    f *= nr / i - r;
+            }
+            else {
+                for (int i = k + 1; i <= m; ++i)
+                    V *= nr / i - r;
+            }
+            if (V <= f)
+                return k;
+            continue;
+        }
+        /// squeeze
+        V = std::log(V);
+        double rho = (km / npq) * (((km / 3.0 + 0.625) * km + 1.0 / 6) / npq + 0.5);
+        double t = -0.5 * km * km / npq;
+        if (V < t - rho)
+            return k;
+        if (V > t + rho)
+            continue;
+        /// final acceptance with Stirling's formula
+        double nm = number - m + 1;
+        double h = (m + 0.5) * std::log((m + 1) / (r * nm)) + stirlingCorrection(m) + stirlingCorrection(number - m);
+        double nk = number - k + 1;
+        if (V <= h + (number + 1) * std::log(nm / nk) + (k + 0.5) * std::log(nk * r / (k + 1)) - stirlingCorrection(k) - stirlingCorrection(number - k))
+            return k;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
+}
+
 int BinomialDistribution::Variate() const
 {
     GENERATOR_ID genId = GetIdOfUsedGenerator();
@@ -290,11 +387,11 @@ int BinomialDistribution::Variate(int number, double probability, RandGenerator
     if (probability == 1.0)
         return number;
 
-    if (number < 10)
-        return variateBernoulliSum(number, probability, randGenerator);
-    if (probability < 0.5)
-        return variateWaiting(number, probability, randGenerator);
-    return number - variateWaiting(number, 1.0 - probability, randGenerator);
+    if (probability > 0.5)
+        return number - Variate(number, 1.0 - probability, randGenerator);
+    if (number * probability < 10)
+        return variateInversion(number, probability, randGenerator);
+    return variateTransformedRejection(number, probability, randGenerator);
 }
 
 void BinomialDistribution::Sample(std::vector<int> &outputData) const
@@ -346,12 +443,54 @@ void BinomialDistribution::Sample(std::vector<int> &outputData) const
     }
 }
 
+template <typename IntType>
+void BinomialDistribution::sampleNarrow(std::vector<IntType> &outputData) const
+{
+    if (n > std::numeric_limits<IntType>::max())
+        throw std::invalid_argument("Binomial distribution: number of trials is too large for the type of output");
+    size_t size = outputData.size();
+    std::vector<int> block(std::min(size, RandGenerator::BLOCK_SIZE));
+    for (size_t i = 0; i < size; i += block.size()) {
+        block.resize(std::min(size - i, block.size()));
+        Sample(block);
+        std::copy(block.begin(), block.end(), outputData.begin() + i);
+    }
+}
+
+void BinomialDistribution::Sample(std::vector<uint8_t> &outputData) const
+{
+    sampleNarrow(outputData);
+}
+
+void BinomialDistribution::Sample(std::vector<uint16_t> &outputData) const
+{
+    sampleNarrow(outputData);
+}
+
 void BinomialDistribution::Reseed(unsigned long seed) const
 {
     localRandGenerator.Reseed(seed);
     G.Reseed(seed);
 }
 
+void BinomialDistribution::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    G.SetEngine(prototype);
+}
+
+void BinomialDistribution::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    G.SaveState(outputStream);
+}
+
+void BinomialDistribution::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    G.LoadState(inputStream);
+}
+
 double BinomialDistribution::Mean() const
 {
     return np;
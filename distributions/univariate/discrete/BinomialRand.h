@@ -4,6 +4,7 @@
 #include "DiscreteDistribution.h"
 #include "GeometricRand.h"
 #include "../continuous/BetaRand.h"
+#include <cstdint>
 
 /**
  * @brief The BinomialDistribution class <BR>
@@ -87,14 +88,50 @@ private:
 
     int variateRejection() const;
     int variateWaiting(int number) const;
-    static int variateWaiting(int number, double probability, RandGenerator &randGenerator);
     static int variateBernoulliSum(int number, double probability, RandGenerator &randGenerator);
+    /**
+     * @fn variateInversion
+     * sequential search from zero, used for n * p < 10
+     * @param number n
+     * @param probability p <= 0.5
+     * @param randGenerator
+     * @return binomial variate
+     */
+    static int variateInversion(int number, double probability, RandGenerator &randGenerator);
+    /**
+     * @fn variateTransformedRejection
+     * BTRD algorithm (Hörmann, 1993), O(1) expected time without setup, valid for n * p >= 10
+     * @param number n
+     * @param probability p <= 0.5
+     * @param randGenerator
+     * @return binomial variate
+     */
+    static int variateTransformedRejection(int number, double probability, RandGenerator &randGenerator);
+
+    /**
+     * @fn sampleNarrow
+     * fill vector by variates of Sample(), converted to narrow integer type
+     * @param outputData
+     */
+    template <typename IntType>
+    void sampleNarrow(std::vector<IntType> &outputData) const;
 
 public:
     int Variate() const override;
     static int Variate(int number, double probability, RandGenerator &randGenerator = staticRandGenerator);
     void Sample(std::vector<int> &outputData) const override;
+    /**
+     * @fn Sample
+     * narrow versions for small number of trials
+     * @param outputData
+     * @throw std::invalid_argument if number of trials doesn't fit the type
+     */
+    void Sample(std::vector<uint8_t> &outputData) const;
+    void Sample(std::vector<uint16_t> &outputData) const;
     void Reseed(unsigned long seed) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
+    void SaveState(std::ostream &outputStream) const override;
+    void LoadState(std::istream &inputStream) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -16,13 +16,75 @@ String CategoricalRand::Name() const
 
 void CategoricalRand::SetProbabilities(std::vector<double> &&probabilities)
 {
-    if (probabilities.size() == 0 || std::accumulate(probabilities.begin(), probabilities.end(), 0.0) != 1.0)
+    if (probabilities.size() == 0 || std::any_of(probabilities.begin(), probabilities.end(), [] (double p) { return p < 0; }))
+        throw std::invalid_argument("Categorical distribution: probability parameters should be non-negative");
+    /// exact equality can't be expected from the sum of large number of probabilities
+    double sum = std::accumulate(probabilities.begin(), probabilities.end(), 0.0);
+    if (!RandMath::areClose(sum, 1.0))
         throw std::invalid_argument("Categorical distribution: probability parameters should sum to 1");
-    else {
-        prob = std::move(probabilities);
-    }
 
+    prob = std::move(probabilities);
     K = prob.size();
+    for (double & p : prob)
+        p /= sum;
+
+    setupCumulative();
+    setupAlias();
+}
+
+void CategoricalRand::setupCumulative()
+{
+    cumProb.resize(K);
+    double sum = 0.0;
+    for (int i = 0; i != K; ++i) {
+        sum += prob[i];
+        cumProb[i] = sum;
+    }
+    cumProb[K - 1] = 1.0;
+
+    guide.resize(K);
+    int k = 0;
+    for (int j = 0; j != K; ++j) {
+        double level = static_cast<double>(j) / K;
+        while (cumProb[k] < level)
+            ++k;
+        guide[j] = k;
+    }
+}
+
+void CategoricalRand::setupAlias()
+{
+    aliasProb.resize(K);
+    alias.resize(K);
+    /// columns with less than average probability are kept at the front, the rest are at the back
+    std::vector<int> columns(K);
+    int smallEnd = 0, largeBegin = K;
+    for (int i = 0; i != K; ++i) {
+        aliasProb[i] = prob[i] * K;
+        alias[i] = i;
+        if (aliasProb[i] < 1.0)
+            columns[smallEnd++] = i;
+        else
+            columns[--largeBegin] = i;
+    }
+    /// fill every small column by the mass of a large one
+    int smallBegin = 0;
+    while (smallBegin != smallEnd && largeBegin != K) {
+        int small = columns[smallBegin++];
+        int large = columns[largeBegin];
+        alias[small] = large;
+        aliasProb[large] -= 1.0 - aliasProb[small];
+        if (aliasProb[large] < 1.0) {
+            /// large column becomes small, its place is the freed slot
+            ++largeBegin;
+            columns[--smallBegin] = large;
+        }
+    }
+    /// the rest differ from 1 only by rounding errors
+    for (int i = smallBegin; i != smallEnd; ++i)
+        aliasProb[columns[i]] = 1.0;
+    for (int i = largeBegin; i != K; ++i)
+        aliasProb[columns[i]] = 1.0;
 }
 
 double CategoricalRand::P(const int & k) const
@@ -39,24 +101,32 @@ double CategoricalRand::F(const int & k) const
 {
     if (k < 0)
         return 0.0;
-    if (k >= K)
-        return 1.0;
-    if (2 * k <= K) {
-        double sum = 0.0;
-        for (int i = 0; i <= k; ++i)
-            sum += prob[i];
-        return sum;
-    }
-    double sum = 1.0;
-    for (int i = K - 1; i > k; --i)
-        sum -= prob[i];
-    return sum;
+    return (k >= K) ? 1.0 : cumProb[k];
 }
 
 int CategoricalRand::Variate() const
 {
+    /// alias method: uniformly chosen column keeps its outcome or passes to the alias
     double U = UniformRand::StandardVariate(localRandGenerator);
-    return quantileImpl(U);
+    int column = std::min(static_cast<int>(U * K), K - 1);
+    double V = UniformRand::StandardVariate(localRandGenerator);
+    return (V < aliasProb[column]) ? column : alias[column];
+}
+
+void CategoricalRand::Sample(std::vector<int> &outputData) const
+{
+    /// uniform variates are generated by blocks in the same order as in Variate()
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    double U[2 * blockSize];
+    size_t size = outputData.size();
+    for (size_t i = 0; i < size; i += blockSize) {
+        size_t length = std::min(size - i, blockSize);
+        localRandGenerator.FillUniform(U, 2 * length);
+        for (size_t j = 0; j != length; ++j) {
+            int column = std::min(static_cast<int>(U[2 * j] * K), K - 1);
+            outputData[i + j] = (U[2 * j + 1] < aliasProb[column]) ? column : alias[column];
+        }
+    }
 }
 
 double CategoricalRand::Mean() const
@@ -86,24 +156,22 @@ int CategoricalRand::Mode() const
 
 int CategoricalRand::quantileImpl(double p) const
 {
-    double sum = 0.0;
-    for (int i = 0; i != K; ++i) {
-        sum += prob[i];
-        if (RandMath::areClose(sum, p) || sum > p)
-            return i;
-    }
-    return K - 1;
+    /// guide table leads to the first candidate, the expected number of steps is less than 2
+    int j = std::min(static_cast<int>(p * K), K - 1);
+    int k = guide[j];
+    /// p * K might be rounded up to the next level
+    while (k > 0 && cumProb[k - 1] >= p)
+        --k;
+    while (cumProb[k] < p)
+        ++k;
+    return k;
 }
 
 int CategoricalRand::quantileImpl1m(double p) const
 {
-    double sum = 0;
-    for (int i = K - 1; i >= 0; --i) {
-        sum += prob[i];
-        if (RandMath::areClose(sum, p) || sum > p)
-            return i;
-    }
-    return 0.0;
+    /// the largest k with P(X >= k) >= p is the number of k with F(k) <= 1 - p
+    auto it = std::upper_bound(cumProb.begin(), cumProb.end(), 1.0 - p);
+    return std::min(static_cast<int>(std::distance(cumProb.begin(), it)), K - 1);
 }
 
 std::complex<double> CategoricalRand::CFImpl(double t) const
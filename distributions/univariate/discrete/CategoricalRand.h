@@ -20,6 +20,11 @@ class RANDLIBSHARED_EXPORT CategoricalRand : public DiscreteDistribution
     std::vector<double> prob{1.0}; ///< vector of probabilities
     int K = 1; ///< number of possible outcomes
 
+    std::vector<double> cumProb{1.0}; ///< F(k)
+    std::vector<int> guide{0}; ///< guide table: guide[j] = min{k : F(k) >= j / K}
+    std::vector<double> aliasProb{1.0}; ///< probability to keep the column in alias method
+    std::vector<int> alias{0}; ///< outcome, which replaces the column otherwise
+
 public:
     explicit CategoricalRand(std::vector<double>&& probabilities);
     String Name() const override;
@@ -34,12 +39,24 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
     int Mode() const override;
 
 private:
+    /**
+     * @fn setupCumulative
+     * fill cumulative probabilities and guide table for O(1) expected time of quantile
+     */
+    void setupCumulative();
+    /**
+     * @fn setupAlias
+     * build table of Walker's alias method by Vose's algorithm in O(K)
+     */
+    void setupAlias();
+
     int quantileImpl(double p) const override;
     int quantileImpl1m(double p) const override;
     std::complex<double> CFImpl(double t) const override;
@@ -1,5 +1,6 @@
 #include "DiscreteDistribution.h"
 #include "../continuous/GammaRand.h"
+#include "../continuous/UniformRand.h"
 
 void DiscreteDistribution::ProbabilityMassFunction(const std::vector<int> &x, std::vector<double> &y) const
 {
@@ -42,6 +43,232 @@ int DiscreteDistribution::Mode() const
     return x;
 }
 
+DiscreteDistribution::RatioOfUniformsSetup DiscreteDistribution::setupRatioOfUniforms() const
+{
+    RatioOfUniformsSetup setup{};
+    setup.minValue = MinValue();
+    setup.maxValue = MaxValue();
+
+    /// ratio P(k + 1) / P(k) decreases, so the mode is the first k where it doesn't exceed 1
+    int low = setup.minValue, high = setup.maxValue;
+    while (low < high) {
+        int k = low + (high - low) / 2;
+        if (logP(k + 1) <= logP(k))
+            high = k;
+        else
+            low = k + 1;
+    }
+    setup.mode = low;
+    setup.logPMode = logP(low);
+
+    /// v = (x - a) * sqrt(P(floor(x)) / P(mode)) with a = mode + 0.5 is unimodal on each side of the mode,
+    /// its extrema are reached at the integer edges of the steps
+    double a = setup.mode + 0.5;
+    auto vRight = [this, a, &setup] (int k) {
+        return (k + 1 - a) * std::exp(0.5 * (logP(k) - setup.logPMode));
+    };
+    low = setup.mode;
+    high = setup.maxValue;
+    while (low < high) {
+        int k = low + (high - low) / 2;
+        if (vRight(k + 1) <= vRight(k))
+            high = k;
+        else
+            low = k + 1;
+    }
+    setup.vMax = vRight(low);
+
+    auto vLeft = [this, a, &setup] (int k) {
+        return (k - a) * std::exp(0.5 * (logP(k) - setup.logPMode));
+    };
+    low = setup.minValue;
+    high = setup.mode;
+    while (low < high) {
+        int k = low + (high - low) / 2;
+        /// strict inequality, as far tail can underflow to zero
+        if (vLeft(k) < vLeft(k + 1))
+            high = k;
+        else
+            low = k + 1;
+    }
+    setup.vMin = vLeft(low);
+    return setup;
+}
+
+int DiscreteDistribution::variateRatioOfUniforms(const RatioOfUniformsSetup &setup) const
+{
+    double a = setup.mode + 0.5;
+    double vRange = setup.vMax - setup.vMin;
+    int iter = 0;
+    do {
+        double U = UniformRand::StandardVariate(localRandGenerator);
+        double V = setup.vMin + vRange * UniformRand::StandardVariate(localRandGenerator);
+        double X = a + V / U;
+        if (!(X >= setup.minValue && X < setup.maxValue + 1.0))
+            continue;
+        int k = std::floor(X);
+        double T = logP(k) - setup.logPMode;
+        /// squeezes for 2 * log(U) <= T, built on U - 1/U <= 2 * log(U) <= 4U - U^2 - 3
+        if (U * (4.0 - U) - 3.0 <= T)
+            return k;
+        if (U * (U - T) >= 1.0)
+            continue;
+        if (2 * std::log(U) <= T)
+            return k;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
+}
+
+DiscreteDistribution::GuideTableSetup DiscreteDistribution::setupGuideTable(size_t maxSize, double maxTailProbability) const
+{
+    /// probability of the left tail and lower bound for the one of the right tail,
+    /// values there are not tabulated, but still generated exactly
+    static constexpr double epsilon = 1e-10;
+    GuideTableSetup setup{};
+    setup.maxSize = maxSize;
+    int minVal = MinValue(), maxVal = MaxValue();
+    /// finite support, which fits in the table, is tabulated entirely
+    bool isWholeSupport = minVal > INT_MIN && maxVal < INT_MAX && static_cast<long long>(maxVal) - minVal < static_cast<long long>(maxSize);
+    setup.minValue = (isWholeSupport || (minVal > INT_MIN && P(minVal) >= epsilon)) ? minVal : Quantile(epsilon);
+    setup.cdfStart = (setup.minValue > minVal) ? F(setup.minValue - 1) : 0.0;
+
+    /// heavy tails are checked before the tabulation, points go with doubling steps,
+    /// so that S(k) isn't evaluated far beyond the bulk of light tails
+    long long lastValue = setup.minValue + static_cast<long long>(maxSize) - 1;
+    if (lastValue < maxVal && maxTailProbability < 1.0) {
+        long long point = setup.minValue, step = 1;
+        do {
+            point = std::min(point + step, lastValue);
+            step *= 2;
+            if (setup.cdfStart + S(static_cast<int>(point)) <= maxTailProbability)
+                break;
+            if (point == lastValue) {
+                setup.isCut = true;
+                return setup;
+            }
+        } while (true);
+    }
+
+    double cdf = setup.cdfStart;
+    int k = setup.minValue;
+    while (true) {
+        double pmf = P(k);
+        /// inaccurate P(k) would send every variate into the search outside of the table
+        if (!std::isfinite(pmf)) {
+            setup.cdf.clear();
+            return setup;
+        }
+        cdf += pmf;
+        setup.cdf.push_back(cdf);
+        if (cdf >= 1.0 - epsilon || k == maxVal)
+            break;
+        if (setup.cdf.size() >= maxSize) {
+            setup.isCut = true;
+            break;
+        }
+        ++k;
+    }
+
+    size_t size = setup.cdf.size();
+    setup.guide.resize(size);
+    double range = cdf - setup.cdfStart;
+    size_t i = 0;
+    for (size_t j = 0; j != size; ++j) {
+        double level = setup.cdfStart + range * j / size;
+        while (setup.cdf[i] < level)
+            ++i;
+        setup.guide[j] = i;
+    }
+    return setup;
+}
+
+int DiscreteDistribution::quantileGuideTable(const GuideTableSetup &setup, double p) const
+{
+    const std::vector<double> &cdf = setup.cdf;
+    double cdfEnd = cdf.back();
+    if (!(p > setup.cdfStart && p <= cdfEnd))
+        return quantileOutsideGuideTable(setup, p);
+    size_t size = cdf.size();
+    size_t index = (p - setup.cdfStart) / (cdfEnd - setup.cdfStart) * size;
+    size_t i = setup.guide[std::min(index, size - 1)];
+    while (cdf[i] < p)
+        ++i;
+    /// index might be rounded up to the next level
+    while (i > 0 && cdf[i - 1] >= p)
+        --i;
+    return setup.minValue + static_cast<int>(i);
+}
+
+int DiscreteDistribution::quantileOutsideGuideTable(const GuideTableSetup &setup, double p) const
+{
+    /// F(k) >= p is checked via S(k) in the right tail for better precision
+    bool rightTail = p > setup.cdfStart;
+    double q = 1.0 - p;
+    auto isReached = [this, rightTail, p, q] (long long k)
+    {
+        return rightTail ? S(k) <= q : F(k) >= p;
+    };
+
+    /// exponential search for the bracket (down, up], where F(down) < p <= F(up),
+    /// ends of the support are never evaluated
+    long long lowest = MinValue(), highest = MaxValue();
+    long long down, up, step = 1;
+    if (rightTail) {
+        down = setup.minValue + static_cast<long long>(setup.cdf.size()) - 1;
+        up = std::min(down + step, highest);
+        while (up < highest && !isReached(up)) {
+            down = up;
+            step *= 2;
+            up = std::min(down + step, highest);
+        }
+    }
+    else {
+        up = setup.minValue - 1LL;
+        if (up < lowest)
+            return lowest;
+        down = std::max(up - step, lowest - 1);
+        while (down >= lowest && isReached(down)) {
+            up = down;
+            step *= 2;
+            down = std::max(up - step, lowest - 1);
+        }
+    }
+
+    /// bisection
+    while (up - down > 1) {
+        long long middle = down + (up - down) / 2;
+        if (isReached(middle))
+            up = middle;
+        else
+            down = middle;
+    }
+    return up;
+}
+
+bool DiscreteDistribution::sampleByGuideTable(std::vector<int> &outputData, GuideTableSetup &table) const
+{
+    size_t size = outputData.size();
+    if (size < MIN_GUIDE_TABLE_SAMPLE)
+        return false;
+    /// table is shorter than the sample, hence the setup costs only a fraction of P(k) call per variate;
+    /// the cut one is rebuilt for much longer samples only
+    size_t maxSize = std::min(size / 4, MAX_GUIDE_TABLE_SIZE);
+    if (table.maxSize == 0 || (table.isCut && maxSize >= 2 * table.maxSize))
+        table = setupGuideTable(maxSize, MAX_GUIDE_TABLE_TAIL);
+    /// search outside of the table is slow, so heavy tails are left for Variate()
+    if (table.cdf.empty())
+        return false;
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    double U[blockSize];
+    for (size_t i = 0; i < size; i += blockSize) {
+        size_t length = std::min(size - i, blockSize);
+        localRandGenerator.FillUniform(U, length);
+        for (size_t j = 0; j != length; ++j)
+            outputData[i + j] = quantileGuideTable(table, U[j]);
+    }
+    return true;
+}
+
 int DiscreteDistribution::quantileImpl(double p) const
 {
     /// We use quantile from sample as an initial guess
@@ -46,7 +46,95 @@ public:
 
     int Mode() const override;
 
+protected:
+    /**
+     * @brief The RatioOfUniformsSetup struct
+     * constants of the ratio-of-uniforms method for log-concave distributions:
+     * candidate is floor(mode + 0.5 + v / u) for u ~ U(0, 1] and v ~ U[vMin, vMax]
+     */
+    struct RatioOfUniformsSetup
+    {
+        int minValue, maxValue; ///< support
+        int mode; ///< mode
+        double logPMode; ///< logarithm of probability to get the mode
+        double vMin, vMax; ///< bounds of the exact enclosing rectangle
+    };
+
+    /**
+     * @fn setupRatioOfUniforms
+     * find mode and the smallest enclosing rectangle by binary search,
+     * valid only for log-concave distributions with finite support
+     * @return constants for variateRatioOfUniforms()
+     */
+    RatioOfUniformsSetup setupRatioOfUniforms() const;
+
+    /**
+     * @fn variateRatioOfUniforms
+     * exact sampling with bounded expected number of logP() calls
+     * @param setup constants returned by setupRatioOfUniforms()
+     * @return random variate or -1 if the rejection failed
+     */
+    int variateRatioOfUniforms(const RatioOfUniformsSetup &setup) const;
+
+    /**
+     * @brief The GuideTableSetup struct
+     * cumulative probabilities of consecutive values, starting from Quantile(epsilon),
+     * and guide table for their indexed search
+     */
+    struct GuideTableSetup
+    {
+        int minValue = 0; ///< first tabulated value
+        double cdfStart = 0; ///< P(X < minValue)
+        std::vector<double> cdf{}; ///< P(X <= minValue + i), empty if the table leaves too much probability in the tails
+        std::vector<size_t> guide{}; ///< smallest index i with cdf[i] >= cdfStart + (cdf.back() - cdfStart) * j / guide.size()
+        size_t maxSize = 0; ///< limit for the number of tabulated values, zero if the table isn't built yet
+        bool isCut = false; ///< true if tabulation was stopped by maxSize
+    };
+
+    /**
+     * @fn setupGuideTable
+     * tabulate P(k) until the remaining probability is negligible or the table reaches maxSize
+     * @param maxSize upper bound for the number of tabulated values
+     * @param maxTailProbability if more probability remains outside of maxSize values,
+     * they are not tabulated and the table is left empty, the same happens if P(k) isn't finite
+     * @return table for quantileGuideTable()
+     */
+    GuideTableSetup setupGuideTable(size_t maxSize, double maxTailProbability = 1.0) const;
+
+    /**
+     * @fn quantileGuideTable
+     * inversion by indexed search, values outside of the table are found by exponential and binary search
+     * with F(k) and S(k), hence the result doesn't depend on the size of the table
+     * @param setup non-empty table returned by setupGuideTable()
+     * @param p probability in (0, 1)
+     * @return smallest k such that F(k) >= p
+     */
+    int quantileGuideTable(const GuideTableSetup &setup, double p) const;
+
+    /**
+     * @fn sampleByGuideTable
+     * fill outputData by inversion, using table, which is not larger than the sample;
+     * the table is built on demand and kept until the parameters change
+     * @param outputData
+     * @param table cached table, should be reset to GuideTableSetup() by each change of parameters
+     * @return false if the sample is too short to pay off the setup or the table leaves too much probability in the tails,
+     * outputData is not modified then
+     */
+    bool sampleByGuideTable(std::vector<int> &outputData, GuideTableSetup &table) const;
+
 private:
+    static constexpr size_t MIN_GUIDE_TABLE_SAMPLE = 1024; ///< shorter samples are generated by Variate()
+    static constexpr size_t MAX_GUIDE_TABLE_SIZE = 1 << 20;
+    static constexpr double MAX_GUIDE_TABLE_TAIL = 0.01; ///< largest probability outside of the table
+
+    /**
+     * @fn quantileOutsideGuideTable
+     * @param setup
+     * @param p probability outside of [setup.cdfStart, setup.cdf.back()]
+     * @return smallest k such that F(k) >= p
+     */
+    int quantileOutsideGuideTable(const GuideTableSetup &setup, double p) const;
+
     int quantileImpl(double p) const override;
     int quantileImpl1m(double p) const override;
     double ExpectedValue(const std::function<double (double)> &funPtr, int minPoint, int maxPoint) const override;
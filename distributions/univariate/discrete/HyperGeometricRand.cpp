@@ -25,12 +25,13 @@ void HyperGeometricRand::SetParameters(int totalSize, int drawsNum, int successe
     n = drawsNum;
     K = successesNum;
 
-    p0 = static_cast<double>(K) / N;
     pmfCoef = RandMath::lfact(K);
     pmfCoef += RandMath::lfact(N - K);
     pmfCoef += RandMath::lfact(N - n);
     pmfCoef += RandMath::lfact(n);
     pmfCoef -= RandMath::lfact(N);
+
+    rouSetup = setupRatioOfUniforms();
 }
 
 double HyperGeometricRand::P(const int & k) const
@@ -72,16 +73,8 @@ double HyperGeometricRand::F(const int & k) const
 
 int HyperGeometricRand::Variate() const
 {
-    double p = p0;
-    int sum = 0;
-    for (int i = 1; i <= n; ++i)
-    {
-        if (BernoulliRand::Variate(p, localRandGenerator) && ++sum >= K)
-            return sum;
-        p = K - sum;
-        p /= N - i;
-    }
-    return sum;
+    /// pmf is log-concave, hence the ratio-of-uniforms method works for any parameters
+    return variateRatioOfUniforms(rouSetup);
 }
 
 double HyperGeometricRand::Mean() const
@@ -2,7 +2,6 @@
 #define HYPERGEOMETRICRAND_H
 
 #include "DiscreteDistribution.h"
-#include "BernoulliRand.h"
 
 /**
  * @brief The HyperGeometricRand class <BR>
@@ -16,7 +15,7 @@ class RANDLIBSHARED_EXPORT HyperGeometricRand : public DiscreteDistribution
     int K = 1; /// number of possible successes
     int n = 1; /// number of draws
     double pmfCoef = 1; ///< C(N, n)
-    double p0 = 1; ///< K/N
+    RatioOfUniformsSetup rouSetup{}; ///< constants for sampling
 
 public:
     HyperGeometricRand(int totalSize, int drawsNum, int successesNum);
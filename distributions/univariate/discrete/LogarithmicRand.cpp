@@ -18,6 +18,7 @@ void LogarithmicRand::SetProbability(double probability)
     p = probability;
     logProb = std::log(p);
     log1mProb = std::log1p(-p);
+    guideTable = GuideTableSetup();
 }
 
 double LogarithmicRand::P(const int & k) const
@@ -70,6 +71,12 @@ int LogarithmicRand::Variate() const
     return std::floor(1.0 + std::log(V) / std::log(y));
 }
 
+void LogarithmicRand::Sample(std::vector<int> &outputData) const
+{
+    if (!sampleByGuideTable(outputData, guideTable))
+        DiscreteDistribution::Sample(outputData);
+}
+
 double LogarithmicRand::Mean() const
 {
     return -p / (1.0 - p) / log1mProb;
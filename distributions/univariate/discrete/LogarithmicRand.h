@@ -16,6 +16,7 @@ class RANDLIBSHARED_EXPORT LogarithmicRand : public DiscreteDistribution
     double p = 1; ///< parameter of distribution
     double logProb = 0; ///< log(p)
     double log1mProb = -INFINITY; ///< log(q)
+    mutable GuideTableSetup guideTable{}; ///< table for long samples, built on demand
 public:
     explicit LogarithmicRand(double probability);
     String Name() const override;
@@ -40,6 +41,7 @@ public:
     double F(const int & k) const override;
     double S(const int & k) const override;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -188,6 +188,27 @@ void NegativeBinomialDistribution<T>::Reseed(unsigned long seed) const
     GammaRV.Reseed(seed + 1);
 }
 
+template< typename T >
+void NegativeBinomialDistribution<T>::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    GammaRV.SetEngine(prototype);
+}
+
+template< typename T >
+void NegativeBinomialDistribution<T>::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    GammaRV.SaveState(outputStream);
+}
+
+template< typename T >
+void NegativeBinomialDistribution<T>::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    GammaRV.LoadState(inputStream);
+}
+
 template< typename T >
 double NegativeBinomialDistribution<T>::Mean() const
 {
@@ -273,7 +294,7 @@ void NegativeBinomialRand<double>::Fit(const std::vector<int> &sample)
     if (!RandMath::findRoot([sample, mean, n] (double x)
     {
         double first = 0.0, second = 0.0;
-        for (const double & var : sample) {
+        for (const int & var : sample) {
             first += RandMath::digamma(var + x);
             second += RandMath::trigamma(var + x);
         }
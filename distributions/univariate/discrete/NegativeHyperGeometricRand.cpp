@@ -27,12 +27,13 @@ void NegativeHyperGeometricRand::SetParameters(int totalSize, int totalSuccesses
 
     m = limitSuccessesNum;
 
-    p0 = static_cast<double>(M) / N;
     pmfCoef = RandMath::lfact(M);
     pmfCoef += RandMath::lfact(N - M);
     pmfCoef -= RandMath::lfact(m - 1);
     pmfCoef -= RandMath::lfact(M - m);
     pmfCoef -= RandMath::lfact(N);
+
+    rouSetup = setupRatioOfUniforms();
 }
 
 double NegativeHyperGeometricRand::P(const int & k) const
@@ -75,17 +76,9 @@ double NegativeHyperGeometricRand::F(const int & k) const
 
 int NegativeHyperGeometricRand::Variate() const
 {
-    double p = p0;
-    int successesNum = 0;
-    int num = 0;
-    while (successesNum < m) {
-        ++num;
-        if (BernoulliRand::Variate(p, localRandGenerator) && ++successesNum == num - N + M)
-            return N - M;
-        p = M - successesNum;
-        p /= N - num;
-    }
-    return num - successesNum;
+    /// the ratio P(k + 1) / P(k) = (k + m)(N - M - k) / ((k + 1)(N - m - k)) decreases,
+    /// so this log-concave pmf is sampled by ratio of uniforms in constant expected time
+    return variateRatioOfUniforms(rouSetup);
 }
 
 double NegativeHyperGeometricRand::Mean() const
@@ -2,7 +2,6 @@
 #define NEGATIVEHYPERGEOMETRICRAND_H
 
 #include "DiscreteDistribution.h"
-#include "BernoulliRand.h"
 
 /**
  * @brief The NegativeHyperGeometricRand class <BR>
@@ -16,7 +15,7 @@ class RANDLIBSHARED_EXPORT NegativeHyperGeometricRand : public DiscreteDistribut
     int M = 1; ///< total amount of successes
     int m = 1; ///< limiting number of successes
     double pmfCoef = 1; ///< C(N, M)
-    double p0 = 1; ///< M / N
+    RatioOfUniformsSetup rouSetup{}; ///< constants for sampling
 
 public:
     NegativeHyperGeometricRand(int totalSize, int totalSuccessesNum, int limitSuccessesNum);
@@ -172,23 +172,49 @@ int PoissonRand::Variate() const
     return generateByInversion() ? variateInversion() : variateRejection();
 }
 
+int PoissonRand::variateInversion(double rate, RandGenerator &randGenerator)
+{
+    double U = UniformRand::StandardVariate(randGenerator);
+    double p = std::exp(-rate), s = p;
+    int k = 0;
+    while (s < U && p > 0) {
+        ++k;
+        p *= rate / k;
+        s += p;
+    }
+    return k;
+}
+
+int PoissonRand::variateTransformedRejection(double rate, RandGenerator &randGenerator)
+{
+    double sqrtRate = std::sqrt(rate), logRate = std::log(rate);
+    double b = 0.931 + 2.53 * sqrtRate;
+    double a = -0.059 + 0.02483 * b;
+    double logAlphaInv = std::log(1.1239 + 1.1328 / (b - 3.4));
+    double vr = 0.9277 - 3.6224 / (b - 2);
+    int iter = 0;
+    do {
+        double U = UniformRand::StandardVariate(randGenerator) - 0.5;
+        double V = UniformRand::StandardVariate(randGenerator);
+        double us = 0.5 - std::fabs(U);
+        double X = std::floor((2 * a / us + b) * U + rate + 0.43);
+        /// squeeze, which accepts most of candidates
+        if (us >= 0.07 && V <= vr)
+            return X;
+        if (X < 0 || (us < 0.013 && V > us))
+            continue;
+        if (std::log(V) + logAlphaInv - std::log(a / (us * us) + b) <= X * logRate - rate - RandMath::lfact(X))
+            return X;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
+}
+
 int PoissonRand::Variate(double rate, RandGenerator &randGenerator)
 {
     /// check validness of parameter
     if (rate <= 0.0)
         return -1;
-    if (rate > 1000) {
-        /// approximate with normal distribution
-        double X = NormalRand::StandardVariate(randGenerator);
-        return std::floor(rate + std::sqrt(rate) * X);
-    }
-    int k = -1;
-    double s = 0;
-    do {
-        s += ExponentialRand::StandardVariate(randGenerator);
-        ++k;
-    } while (s < rate);
-    return k;
+    return (rate < 10) ? variateInversion(rate, randGenerator) : variateTransformedRejection(rate, randGenerator);
 }
 
 void PoissonRand::Sample(std::vector<int> &outputData) const
@@ -49,6 +49,23 @@ private:
     int variateRejection() const;
     int variateInversion() const;
 
+    /**
+     * @fn variateInversion
+     * sequential search from zero, used for small rate
+     * @param rate λ
+     * @param randGenerator
+     * @return Poisson variate
+     */
+    static int variateInversion(double rate, RandGenerator &randGenerator);
+    /**
+     * @fn variateTransformedRejection
+     * PTRS algorithm (Hörmann, 1993), O(1) expected time without setup, valid for λ >= 10
+     * @param rate λ
+     * @param randGenerator
+     * @return Poisson variate
+     */
+    static int variateTransformedRejection(double rate, RandGenerator &randGenerator);
+
 public:
     int Variate() const override;
     static int Variate(double rate, RandGenerator &randGenerator = staticRandGenerator);
@@ -25,6 +25,7 @@ void SkellamRand::SetRates(double rate1, double rate2)
     mu2 = Y.GetRate();
     logMu2 = std::log(mu2);
     sqrtMu2 = std::sqrt(mu2);
+    guideTable = GuideTableSetup();
 }
 
 double SkellamRand::P(const int & k) const
@@ -34,7 +35,8 @@ double SkellamRand::P(const int & k) const
 
 double SkellamRand::logP(const int & k) const
 {
-    double y = RandMath::logBesselI(k, 2 * sqrtMu1 * sqrtMu2);
+    /// I(-k, x) = I(k, x) for integer k, negative order would add rounding error of sin(πk) multiplied by K(k, x)
+    double y = RandMath::logBesselI(std::abs(k), 2 * sqrtMu1 * sqrtMu2);
     y += 0.5 * k * (logMu1 - logMu2);
     y -= mu1 + mu2;
     return y;
@@ -57,6 +59,8 @@ int SkellamRand::Variate() const
 
 void SkellamRand::Sample(std::vector<int> &outputData) const
 {
+    if (sampleByGuideTable(outputData, guideTable))
+        return;
     X.Sample(outputData);
     for (int & var : outputData)
         var -= Y.Variate();
@@ -64,8 +68,30 @@ void SkellamRand::Sample(std::vector<int> &outputData) const
 
 void SkellamRand::Reseed(unsigned long seed) const
 {
-    X.Reseed(seed);
-    Y.Reseed(seed + 1);
+    localRandGenerator.Reseed(seed);
+    X.Reseed(seed + 1);
+    Y.Reseed(seed + 2);
+}
+
+void SkellamRand::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    X.SetEngine(prototype);
+    Y.SetEngine(prototype);
+}
+
+void SkellamRand::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    X.SaveState(outputStream);
+    Y.SaveState(outputStream);
+}
+
+void SkellamRand::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    X.LoadState(inputStream);
+    Y.LoadState(inputStream);
 }
 
 double SkellamRand::Mean() const
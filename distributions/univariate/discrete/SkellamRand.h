@@ -21,6 +21,7 @@ class RANDLIBSHARED_EXPORT SkellamRand : public DiscreteDistribution
     double logMu2 = 0; ///< log(μ2)
     double sqrtMu1 = 1; ///< √μ1
     double sqrtMu2 = 1; ///< √μ2
+    mutable GuideTableSetup guideTable{}; ///< table for long samples, built on demand
 
     PoissonRand X{}, Y{};
 
@@ -42,6 +43,9 @@ public:
     int Variate() const override;
     void Sample(std::vector<int> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
+    void SaveState(std::ostream &outputStream) const override;
+    void LoadState(std::istream &inputStream) const override;
 
     double Mean() const override;
     double Variance() const override;
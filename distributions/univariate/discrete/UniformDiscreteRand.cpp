@@ -18,12 +18,26 @@ void UniformDiscreteRand::SetBoundaries(int minValue, int maxValue)
     a = minValue;
     b = maxValue;
 
-    n = b - a + 1;
+    n = static_cast<long long>(b) - a + 1;
     nInv = 1.0 / n;
     logN = std::log(n);
 
-    unsigned long long MAX_RAND = localRandGenerator.MaxValue();
-    MAX_RAND_UNBIASED = MAX_RAND - MAX_RAND % n - 1;
+    threshold = 4294967296ULL % n;
+    setShift();
+}
+
+void UniformDiscreteRand::setShift() const
+{
+    unsigned long long maxRand = localRandGenerator.MaxValue();
+    if (maxRand >= 4294967295ULL && (maxRand & (maxRand + 1)) == 0) {
+        shift32 = 32 - __builtin_clzll(maxRand);
+        return;
+    }
+    /// range of the engine isn't a power of 2 or is narrower than 32 bits
+    if (maxRand < n - 1)
+        throw std::invalid_argument("Uniform discrete distribution: range of the engine should be not less than the number of outcomes");
+    shift32 = -1;
+    maxUnbiased = maxRand - (maxRand % n + 1) % n;
 }
 
 double UniformDiscreteRand::P(const int & k) const
@@ -45,13 +59,52 @@ double UniformDiscreteRand::F(const int & k) const
     return (k - a + 1) * nInv;
 }
 
-int UniformDiscreteRand::Variate() const
+int UniformDiscreteRand::variateByModulo() const
 {
-    unsigned long intVar;
+    unsigned long long word;
     do {
-        intVar = localRandGenerator.Variate();
-    } while (intVar > MAX_RAND_UNBIASED);
-    return a + (intVar % n);
+        word = localRandGenerator.Variate();
+    } while (word > maxUnbiased);
+    return a + word % n;
+}
+
+int UniformDiscreteRand::Variate() const
+{
+    if (shift32 < 0)
+        return variateByModulo();
+    /// Lemire's multiply-shift: upper half of the product of 32 random bits and n is uniform on [0, n),
+    /// if products with lower half below 2^32 mod n are rejected
+    unsigned long long product = (localRandGenerator.Variate() >> shift32) * n;
+    while ((product & 4294967295ULL) < threshold)
+        product = (localRandGenerator.Variate() >> shift32) * n;
+    return a + (product >> 32);
+}
+
+void UniformDiscreteRand::Sample(std::vector<int> &outputData) const
+{
+    /// multiply-shift on words, drawn a block at a time; rejected ones are replaced by new variates
+    if (shift32 < 0) {
+        for (int & var : outputData)
+            var = variateByModulo();
+        return;
+    }
+    constexpr size_t blockSize = RandGenerator::BLOCK_SIZE;
+    unsigned long long words[blockSize];
+    size_t size = outputData.size();
+    for (size_t i = 0; i < size; i += blockSize) {
+        size_t m = std::min(size - i, blockSize);
+        localRandGenerator.Fill(words, m);
+        for (size_t j = 0; j != m; ++j) {
+            unsigned long long product = (words[j] >> shift32) * n;
+            outputData[i + j] = ((product & 4294967295ULL) < threshold) ? Variate() : a + (product >> 32);
+        }
+    }
+}
+
+void UniformDiscreteRand::SetEngine(const RandGenerator &prototype) const
+{
+    DiscreteDistribution::SetEngine(prototype);
+    setShift();
 }
 
 double UniformDiscreteRand::Mean() const
@@ -19,7 +19,21 @@ class RANDLIBSHARED_EXPORT UniformDiscreteRand : public DiscreteDistribution
     int b = 0; ///< max bound
     double nInv = 1; ///< 1/n
     double logN = 0; ///< log(n)
-    unsigned long long MAX_RAND_UNBIASED = localRandGenerator.MaxValue();///< constant for unbiased generator
+    unsigned long long threshold = 0; ///< 2^32 mod n, products with lower half below it are rejected
+    mutable int shift32 = 0; ///< shift, which takes 32 random bits of the word of the engine, -1 if there are no such bits
+    mutable unsigned long long maxUnbiased = 0; ///< largest word, accepted by the modulo method if shift32 = -1
+
+    /**
+     * @fn setShift
+     * take upper 32 bits of the word for engines with range [0, 2^w), w >= 32,
+     * otherwise choose rejection by the largest unbiased word and modulo
+     */
+    void setShift() const;
+    /**
+     * @fn variateByModulo
+     * @return variate for engines, which don't give 32 uniform bits
+     */
+    int variateByModulo() const;
 
 public:
     UniformDiscreteRand(int minValue = 0, int maxValue = 1);
@@ -34,6 +48,8 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -18,6 +18,7 @@ void YuleRand::SetShape(double shape)
     ro = shape;
     lgamma1pRo = std::lgamma(ro + 1);
     X.SetShape(ro);
+    guideTable = GuideTableSetup();
 }
 
 double YuleRand::P(const int & k) const
@@ -72,12 +73,36 @@ int YuleRand::Variate(double shape, RandGenerator &randGenerator)
     return GeometricRand::Variate(prob, randGenerator) + 1;
 }
 
+void YuleRand::Sample(std::vector<int> &outputData) const
+{
+    if (!sampleByGuideTable(outputData, guideTable))
+        DiscreteDistribution::Sample(outputData);
+}
+
 void YuleRand::Reseed(unsigned long seed) const
 {
     localRandGenerator.Reseed(seed);
     X.Reseed(seed + 1);
 }
 
+void YuleRand::SetEngine(const RandGenerator &prototype) const
+{
+    localRandGenerator.SetEngine(prototype);
+    X.SetEngine(prototype);
+}
+
+void YuleRand::SaveState(std::ostream &outputStream) const
+{
+    localRandGenerator.SaveState(outputStream);
+    X.SaveState(outputStream);
+}
+
+void YuleRand::LoadState(std::istream &inputStream) const
+{
+    localRandGenerator.LoadState(inputStream);
+    X.LoadState(inputStream);
+}
+
 double YuleRand::Mean() const
 {
     return (ro <= 1) ? INFINITY : ro / (ro - 1);
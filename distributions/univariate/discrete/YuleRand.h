@@ -19,6 +19,7 @@ class RANDLIBSHARED_EXPORT YuleRand : public DiscreteDistribution
 {
     double ro = 0; ///< shape ρ
     double lgamma1pRo = 0; /// log(Γ(1 + ρ))
+    mutable GuideTableSetup guideTable{}; ///< table for long samples, built on demand
     
     ParetoRand X;
 public:
@@ -37,7 +38,11 @@ public:
     double S(const int & k) const override;
     int Variate() const override;
     static int Variate(double shape, RandGenerator &randGenerator = staticRandGenerator);
+    void Sample(std::vector<int> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void SetEngine(const RandGenerator &prototype) const override;
+    void SaveState(std::ostream &outputStream) const override;
+    void LoadState(std::istream &inputStream) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -21,6 +21,7 @@ void ZetaRand::SetExponent(double exponent)
     zetaS = std::riemann_zeta(s);
     logZetaS = std::log(zetaS);
     b = -std::expm1(-sm1 * M_LN2);
+    guideTable = GuideTableSetup();
 }
 
 double ZetaRand::P(const int & k) const
@@ -54,6 +55,12 @@ int ZetaRand::Variate() const
     return -1; /// return if algorithm doesn't work
 }
 
+void ZetaRand::Sample(std::vector<int> &outputData) const
+{
+    if (!sampleByGuideTable(outputData, guideTable))
+        DiscreteDistribution::Sample(outputData);
+}
+
 double ZetaRand::Mean() const
 {
     return (s > 2) ? std::riemann_zeta(sm1) / zetaS : INFINITY;
@@ -18,6 +18,7 @@ class RANDLIBSHARED_EXPORT ZetaRand : public DiscreteDistribution
     double zetaS = M_PI_SQ / 6.0; ///< ζ(s), where ζ stands for Riemann zeta-function
     double logZetaS = 2 * M_LNPI - M_LN2 - M_LN3;///< ln(ζ(s))
     double b = 0.5; ///< 1 - 2^(1-s)
+    mutable GuideTableSetup guideTable{}; ///< table for long samples, built on demand
 
 public:
     explicit ZetaRand(double exponent = 2.0);
@@ -33,6 +34,7 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
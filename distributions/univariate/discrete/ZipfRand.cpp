@@ -1,6 +1,33 @@
 #include "ZipfRand.h"
 #include "../continuous/UniformRand.h"
 
+namespace
+{
+/**
+ * @fn log1pDivX
+ * @param x
+ * @return log(1 + x) / x, continuous at 0
+ */
+double log1pDivX(double x)
+{
+    if (std::fabs(x) > 1e-8)
+        return std::log1p(x) / x;
+    return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+/**
+ * @fn expm1DivX
+ * @param x
+ * @return (exp(x) - 1) / x, continuous at 0
+ */
+double expm1DivX(double x)
+{
+    if (std::fabs(x) > 1e-8)
+        return std::expm1(x) / x;
+    return 1.0 + 0.5 * x * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+}
+}
+
 ZipfRand::ZipfRand(double exponent, int number)
 {
     SetParameters(exponent, number);
@@ -23,17 +50,24 @@ void ZipfRand::SetParameters(double exponent, int number)
 
     invHarmonicNumber = 1.0 / RandMath::harmonicNumber(s, n);
 
-    // WARNING: we calculate pow here and in invHarmonic number
-    hashedVarNum = n > tableSize ? tableSize : n;
-    table[0] = 1.0;
-    for (int i = 1; i < hashedVarNum - 1; ++i)
-        table[i] = table[i - 1] + std::pow(i + 1, -s);
-    if (hashedVarNum == n)
-        table[hashedVarNum - 1] = 1.0 / invHarmonicNumber;
-    else
-        table[hashedVarNum - 1] = table[hashedVarNum - 2] + std::pow(hashedVarNum, -s);
-    for (int i = 0; i < hashedVarNum; ++i)
-        table[i] *= invHarmonicNumber;
+    hIntegralX1 = hIntegral(1.5) - 1.0;
+    hIntegralN = hIntegral(n + 0.5);
+    squeezeWidth = 2.0 - hIntegralInverse(hIntegral(2.5) - std::pow(2, -s));
+}
+
+double ZipfRand::hIntegral(double x) const
+{
+    double logX = std::log(x);
+    return expm1DivX((1.0 - s) * logX) * logX;
+}
+
+double ZipfRand::hIntegralInverse(double x) const
+{
+    double t = x * (1.0 - s);
+    /// protection against rounding errors near the left bound
+    if (t < -1.0)
+        t = -1.0;
+    return std::exp(log1pDivX(t) * x);
 }
 
 double ZipfRand::P(const int & k) const
@@ -57,22 +91,22 @@ double ZipfRand::F(const int & k) const
 
 int ZipfRand::Variate() const
 {
-    double U = UniformRand::StandardVariate(localRandGenerator);
-    int k = 1;
-    /// if we didn't manage to hash values for such U
-    if (U > table[hashedVarNum - 1]) {
-        k = hashedVarNum;
-        double sum = table[hashedVarNum - 1];
-        do {
-            ++k;
-            sum += std::pow(k, -s) * invHarmonicNumber;
-        } while (sum < U);
-    }
-    else {
-        while (k <= hashedVarNum && table[k - 1] < U)
-            ++k;
-    }
-    return k;
+    /// rejection-inversion of Hörmann and Derflinger:
+    /// hat is x^(-s) on [k - 0.5, k + 0.5], inversion is done for its integral
+    int iter = 0;
+    do {
+        double U = UniformRand::StandardVariate(localRandGenerator);
+        double u = hIntegralN + U * (hIntegralX1 - hIntegralN);
+        double x = hIntegralInverse(u);
+        double k = std::floor(x + 0.5);
+        if (k < 1)
+            k = 1;
+        else if (k > n)
+            k = n;
+        if (k - x <= squeezeWidth || u >= hIntegral(k + 0.5) - std::pow(k, -s))
+            return static_cast<int>(k);
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
 }
 
 double ZipfRand::Mean() const
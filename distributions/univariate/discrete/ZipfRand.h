@@ -16,9 +16,10 @@ class RANDLIBSHARED_EXPORT ZipfRand : public DiscreteDistribution
     int n = 1; ///< number
     double invHarmonicNumber = 1; /// 1 / H(s, n)
 
-    static constexpr int tableSize = 16;
-    int hashedVarNum = 1;
-    double table[tableSize];
+    /// constants for rejection-inversion, where I(x) is antiderivative of the hat function x^(-s)
+    double hIntegralX1 = 0; ///< I(1.5) - 1
+    double hIntegralN = 0; ///< I(n + 0.5)
+    double squeezeWidth = 0; ///< 2 - I^(-1)(I(2.5) - 2^(-s))
 
 public:
     ZipfRand(double exponent, int number);
@@ -43,6 +44,19 @@ public:
     double ExcessKurtosis() const override;
 
 private:
+    /**
+     * @fn hIntegral
+     * @param x
+     * @return (x^(1-s) - 1) / (1 - s)
+     */
+    double hIntegral(double x) const;
+    /**
+     * @fn hIntegralInverse
+     * @param x
+     * @return inverse function of hIntegral()
+     */
+    double hIntegralInverse(double x) const;
+
     std::complex<double> CFImpl(double t) const override;
 };
 
@@ -193,10 +193,33 @@ double harmonicNumber(double exponent, int number)
         return M_EULER + digamma(number + 1);
     if (exponent == 2)
         return M_PI_SQ / 6.0 - trigamma(number + 1);
+    /// direct summation of the first terms
+    static constexpr int directTerms = 32;
     double res = 1.0;
-    for (int i = 2; i <= number; ++i)
+    int lastDirect = std::min(number, directTerms);
+    for (int i = 2; i <= lastDirect; ++i)
         res += std::pow(i, -exponent);
-    return res;
+    if (number == lastDirect)
+        return res;
+    /// Euler-Maclaurin formula for the rest, the remainder is below double precision
+    double a = directTerms + 1, b = number;
+    double fa = std::pow(a, -exponent), fb = std::pow(b, -exponent);
+    /// integral (b^(1-s) - a^(1-s)) / (1 - s) without cancellation for s close to 1
+    double integral = a * fa * std::expm1((1.0 - exponent) * std::log(b / a)) / (1.0 - exponent);
+    double tail = integral + 0.5 * (fa + fb);
+    /// derivatives f^(2j-1)(x) = -s(s+1)...(s+2j-2) x^(-s-2j+1)
+    double coef = -exponent;
+    double da = coef * fa / a, db = coef * fb / b;
+    tail += (db - da) / 12.0;
+    coef *= (exponent + 1) * (exponent + 2);
+    da = coef * fa / (a * a * a);
+    db = coef * fb / (b * b * b);
+    tail -= (db - da) / 720.0;
+    coef *= (exponent + 3) * (exponent + 4);
+    da = coef * fa / std::pow(a, 5);
+    db = coef * fb / std::pow(b, 5);
+    tail += (db - da) / 30240.0;
+    return res + tail;
 }
 
 long double logBesselI(double nu, double x)
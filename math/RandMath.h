@@ -13,6 +13,7 @@
 #include "GammaMath.h"
 #include "BetaMath.h"
 #include "NumericMath.h"
+#include "VectorMath.h"
 
 namespace RandMath
 {
@@ -92,7 +93,7 @@ double xexpxsqerfc(double x);
  * @fn harmonicNumber
  * @param exponent
  * @param number
- * @return sum_{i=1}^{number} i^{-exponent}
+ * @return sum_{i=1}^{number} i^{-exponent}, O(1) for large number
  */
 double harmonicNumber(double exponent, int number);
 
@@ -0,0 +1,257 @@
+#include "VectorMath.h"
+
+#ifdef RANDLIB_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace RandMath
+{
+
+namespace
+{
+
+size_t zigguratLayersScalar(const unsigned long long *words, const double *uniforms, size_t start, size_t size,
+                            const double *width, const double *ratio, bool symmetric,
+                            double *output, size_t *rejected, size_t rejectedSize)
+{
+    for (size_t j = start; j != size; ++j) {
+        int layer = words[j] & 255;
+        double x = uniforms[j] * width[layer];
+        output[j] = (symmetric && ((words[j] >> 8) & 1)) ? -x : x;
+        if (!(uniforms[j] < ratio[layer]))
+            rejected[rejectedSize++] = j;
+    }
+    return rejectedSize;
+}
+
+size_t zigguratLayersScalar(const unsigned int *words, size_t start, size_t size,
+                            const float *width, const float *ratio, bool symmetric,
+                            float *output, size_t *rejected, size_t rejectedSize)
+{
+    for (size_t j = start; j != size; ++j) {
+        int layer = words[j] & 255;
+        float u = ((words[j] >> 9) + 0.5f) * 1.1920929e-7f; /// 2^-23
+        float x = u * width[layer];
+        output[j] = (symmetric && ((words[j] >> 8) & 1)) ? -x : x;
+        if (!(u < ratio[layer]))
+            rejected[rejectedSize++] = j;
+    }
+    return rejectedSize;
+}
+
+size_t marsagliaTsangSqueezeScalar(const double *normals, const double *uniforms, size_t start, size_t size, double c, double squeeze,
+                                   double *output, size_t *rejected, size_t rejectedSize)
+{
+    for (size_t j = start; j != size; ++j) {
+        double v = 1.0 + c * normals[j];
+        double N2 = normals[j] * normals[j];
+        output[j] = v * v * v;
+        if (!(v > 0.0 && uniforms[j] < 1.0 - squeeze * N2 * N2))
+            rejected[rejectedSize++] = j;
+    }
+    return rejectedSize;
+}
+
+#ifdef RANDLIB_X86_SIMD
+/// 4 candidates at once, layers are gathered from the tables
+__attribute__((target("avx2")))
+size_t zigguratLayersAVX2(const unsigned long long *words, const double *uniforms, size_t size,
+                          const double *width, const double *ratio, bool symmetric,
+                          double *output, size_t *rejected, size_t &rejectedSize)
+{
+    const __m256i layerMask = _mm256_set1_epi64x(255);
+    const __m256i signMask = _mm256_set1_epi64x(symmetric ? 0x8000000000000000LL : 0);
+    size_t j = 0;
+    for (; j + 4 <= size; j += 4) {
+        __m256i word = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + j));
+        __m256i layer = _mm256_and_si256(word, layerMask);
+        __m256d u = _mm256_loadu_pd(uniforms + j);
+        __m256d x = _mm256_mul_pd(u, _mm256_i64gather_pd(width, layer, 8));
+        __m256i sign = _mm256_and_si256(_mm256_slli_epi64(word, 55), signMask);
+        _mm256_storeu_pd(output + j, _mm256_xor_pd(x, _mm256_castsi256_pd(sign)));
+        __m256d accepted = _mm256_cmp_pd(u, _mm256_i64gather_pd(ratio, layer, 8), _CMP_LT_OQ);
+        for (int mask = ~_mm256_movemask_pd(accepted) & 15; mask != 0; mask &= mask - 1)
+            rejected[rejectedSize++] = j + __builtin_ctz(mask);
+    }
+    return j;
+}
+
+/// 8 candidates at once, zero-masked forms of intrinsics avoid false warnings of GCC
+__attribute__((target("avx512f")))
+size_t zigguratLayersAVX512(const unsigned long long *words, const double *uniforms, size_t size,
+                            const double *width, const double *ratio, bool symmetric,
+                            double *output, size_t *rejected, size_t &rejectedSize)
+{
+    const __m512i layerMask = _mm512_set1_epi64(255);
+    const __m512i signMask = _mm512_set1_epi64(symmetric ? 0x8000000000000000LL : 0);
+    size_t j = 0;
+    for (; j + 8 <= size; j += 8) {
+        __m512i word = _mm512_loadu_si512(words + j);
+        __m512i layer = _mm512_and_si512(word, layerMask);
+        __m512d u = _mm512_loadu_pd(uniforms + j);
+        __m512d x = _mm512_mul_pd(u, _mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, layer, width, 8));
+        __m512i sign = _mm512_and_si512(_mm512_maskz_slli_epi64(0xFF, word, 55), signMask);
+        _mm512_storeu_pd(output + j, _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x), sign)));
+        __mmask8 accepted = _mm512_cmp_pd_mask(u, _mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, layer, ratio, 8), _CMP_LT_OQ);
+        for (unsigned mask = ~accepted & 255u; mask != 0; mask &= mask - 1)
+            rejected[rejectedSize++] = j + __builtin_ctz(mask);
+    }
+    return j;
+}
+
+/// 8 candidates at once in single precision
+__attribute__((target("avx2")))
+size_t zigguratLayersAVX2(const unsigned int *words, size_t size,
+                          const float *width, const float *ratio, bool symmetric,
+                          float *output, size_t *rejected, size_t &rejectedSize)
+{
+    const __m256i layerMask = _mm256_set1_epi32(255);
+    const __m256i signMask = _mm256_set1_epi32(symmetric ? 0x80000000 : 0);
+    const __m256 half = _mm256_set1_ps(0.5f), scale = _mm256_set1_ps(1.1920929e-7f);
+    size_t j = 0;
+    for (; j + 8 <= size; j += 8) {
+        __m256i word = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + j));
+        __m256i layer = _mm256_and_si256(word, layerMask);
+        __m256 u = _mm256_cvtepi32_ps(_mm256_srli_epi32(word, 9));
+        u = _mm256_mul_ps(_mm256_add_ps(u, half), scale);
+        __m256 x = _mm256_mul_ps(u, _mm256_i32gather_ps(width, layer, 4));
+        __m256i sign = _mm256_and_si256(_mm256_slli_epi32(word, 23), signMask);
+        _mm256_storeu_ps(output + j, _mm256_xor_ps(x, _mm256_castsi256_ps(sign)));
+        __m256 accepted = _mm256_cmp_ps(u, _mm256_i32gather_ps(ratio, layer, 4), _CMP_LT_OQ);
+        for (int mask = ~_mm256_movemask_ps(accepted) & 255; mask != 0; mask &= mask - 1)
+            rejected[rejectedSize++] = j + __builtin_ctz(mask);
+    }
+    return j;
+}
+
+/// 16 candidates at once in single precision
+__attribute__((target("avx512f")))
+size_t zigguratLayersAVX512(const unsigned int *words, size_t size,
+                            const float *width, const float *ratio, bool symmetric,
+                            float *output, size_t *rejected, size_t &rejectedSize)
+{
+    const __m512i layerMask = _mm512_set1_epi32(255);
+    const __m512i signMask = _mm512_set1_epi32(symmetric ? 0x80000000 : 0);
+    const __m512 half = _mm512_set1_ps(0.5f), scale = _mm512_set1_ps(1.1920929e-7f);
+    size_t j = 0;
+    for (; j + 16 <= size; j += 16) {
+        __m512i word = _mm512_loadu_si512(words + j);
+        __m512i layer = _mm512_and_si512(word, layerMask);
+        __m512 u = _mm512_maskz_cvtepi32_ps(0xFFFF, _mm512_maskz_srli_epi32(0xFFFF, word, 9));
+        u = _mm512_mul_ps(_mm512_add_ps(u, half), scale);
+        __m512 x = _mm512_mul_ps(u, _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, layer, width, 4));
+        __m512i sign = _mm512_and_si512(_mm512_maskz_slli_epi32(0xFFFF, word, 23), signMask);
+        _mm512_storeu_ps(output + j, _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(x), sign)));
+        __mmask16 accepted = _mm512_cmp_ps_mask(u, _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, layer, ratio, 4), _CMP_LT_OQ);
+        for (unsigned mask = ~accepted & 0xFFFFu; mask != 0; mask &= mask - 1)
+            rejected[rejectedSize++] = j + __builtin_ctz(mask);
+    }
+    return j;
+}
+
+/// 4 candidates at once
+__attribute__((target("avx2")))
+size_t marsagliaTsangSqueezeAVX2(const double *normals, const double *uniforms, size_t size, double c, double squeeze,
+                                 double *output, size_t *rejected, size_t &rejectedSize)
+{
+    const __m256d one = _mm256_set1_pd(1.0), zero = _mm256_setzero_pd();
+    const __m256d cVec = _mm256_set1_pd(c), squeezeVec = _mm256_set1_pd(squeeze);
+    size_t j = 0;
+    for (; j + 4 <= size; j += 4) {
+        __m256d N = _mm256_loadu_pd(normals + j);
+        __m256d v = _mm256_add_pd(one, _mm256_mul_pd(cVec, N));
+        __m256d N2 = _mm256_mul_pd(N, N);
+        _mm256_storeu_pd(output + j, _mm256_mul_pd(_mm256_mul_pd(v, v), v));
+        __m256d bound = _mm256_sub_pd(one, _mm256_mul_pd(squeezeVec, _mm256_mul_pd(N2, N2)));
+        __m256d accepted = _mm256_and_pd(_mm256_cmp_pd(v, zero, _CMP_GT_OQ),
+                                         _mm256_cmp_pd(_mm256_loadu_pd(uniforms + j), bound, _CMP_LT_OQ));
+        for (int mask = ~_mm256_movemask_pd(accepted) & 15; mask != 0; mask &= mask - 1)
+            rejected[rejectedSize++] = j + __builtin_ctz(mask);
+    }
+    return j;
+}
+
+/// 8 candidates at once, products with explicit rounding aren't fused with sums,
+/// so that the result is the same as in scalar code
+__attribute__((target("avx512f")))
+size_t marsagliaTsangSqueezeAVX512(const double *normals, const double *uniforms, size_t size, double c, double squeeze,
+                                   double *output, size_t *rejected, size_t &rejectedSize)
+{
+    const __m512d one = _mm512_set1_pd(1.0), zero = _mm512_setzero_pd();
+    const __m512d cVec = _mm512_set1_pd(c), squeezeVec = _mm512_set1_pd(squeeze);
+    size_t j = 0;
+    for (; j + 8 <= size; j += 8) {
+        __m512d N = _mm512_loadu_pd(normals + j);
+        __m512d v = _mm512_add_pd(one, _mm512_maskz_mul_round_pd(0xFF, cVec, N, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        __m512d N2 = _mm512_mul_pd(N, N);
+        _mm512_storeu_pd(output + j, _mm512_mul_pd(_mm512_mul_pd(v, v), v));
+        __m512d N4 = _mm512_mul_pd(N2, N2);
+        __m512d bound = _mm512_sub_pd(one, _mm512_maskz_mul_round_pd(0xFF, squeezeVec, N4, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        __mmask8 accepted = _mm512_cmp_pd_mask(v, zero, _CMP_GT_OQ)
+                          & _mm512_cmp_pd_mask(_mm512_loadu_pd(uniforms + j), bound, _CMP_LT_OQ);
+        for (unsigned mask = ~accepted & 255u; mask != 0; mask &= mask - 1)
+            rejected[rejectedSize++] = j + __builtin_ctz(mask);
+    }
+    return j;
+}
+#endif
+
+}
+
+SIMD_LEVEL getSIMDLevel()
+{
+#ifdef RANDLIB_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return AVX2;
+#endif
+    return SCALAR;
+}
+
+size_t zigguratLayers(const unsigned long long *words, const double *uniforms, size_t size,
+                      const double *width, const double *ratio, bool symmetric,
+                      double *output, size_t *rejected)
+{
+    size_t start = 0, rejectedSize = 0;
+#ifdef RANDLIB_X86_SIMD
+    static const SIMD_LEVEL level = getSIMDLevel();
+    if (level == AVX512)
+        start = zigguratLayersAVX512(words, uniforms, size, width, ratio, symmetric, output, rejected, rejectedSize);
+    else if (level == AVX2)
+        start = zigguratLayersAVX2(words, uniforms, size, width, ratio, symmetric, output, rejected, rejectedSize);
+#endif
+    return zigguratLayersScalar(words, uniforms, start, size, width, ratio, symmetric, output, rejected, rejectedSize);
+}
+
+size_t zigguratLayers(const unsigned int *words, size_t size,
+                      const float *width, const float *ratio, bool symmetric,
+                      float *output, size_t *rejected)
+{
+    size_t start = 0, rejectedSize = 0;
+#ifdef RANDLIB_X86_SIMD
+    static const SIMD_LEVEL level = getSIMDLevel();
+    if (level == AVX512)
+        start = zigguratLayersAVX512(words, size, width, ratio, symmetric, output, rejected, rejectedSize);
+    else if (level == AVX2)
+        start = zigguratLayersAVX2(words, size, width, ratio, symmetric, output, rejected, rejectedSize);
+#endif
+    return zigguratLayersScalar(words, start, size, width, ratio, symmetric, output, rejected, rejectedSize);
+}
+
+size_t marsagliaTsangSqueeze(const double *normals, const double *uniforms, size_t size, double c, double squeeze,
+                             double *output, size_t *rejected)
+{
+    size_t start = 0, rejectedSize = 0;
+#ifdef RANDLIB_X86_SIMD
+    static const SIMD_LEVEL level = getSIMDLevel();
+    if (level == AVX512)
+        start = marsagliaTsangSqueezeAVX512(normals, uniforms, size, c, squeeze, output, rejected, rejectedSize);
+    else if (level == AVX2)
+        start = marsagliaTsangSqueezeAVX2(normals, uniforms, size, c, squeeze, output, rejected, rejectedSize);
+#endif
+    return marsagliaTsangSqueezeScalar(normals, uniforms, start, size, c, squeeze, output, rejected, rejectedSize);
+}
+
+}
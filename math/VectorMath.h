@@ -0,0 +1,103 @@
+#ifndef VECTORMATH_H
+#define VECTORMATH_H
+
+#include <cstddef>
+
+#if !defined(RANDLIB_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RANDLIB_X86_SIMD
+#endif
+
+/// Procedures over blocks of numbers, made in SIMD registers if possible
+
+namespace RandMath
+{
+
+/**
+ * @brief The SIMD_LEVEL enum
+ * widest instruction set, for which vectorized code is compiled
+ */
+enum SIMD_LEVEL {
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @fn getSIMDLevel
+ * @return widest instruction set supported by the running CPU,
+ * SCALAR if the library is built without RANDLIB_X86_SIMD
+ */
+SIMD_LEVEL getSIMDLevel();
+
+/**
+ * @fn zigguratLayers
+ * fast test of ziggurat for a block of candidates:
+ * j-th candidate takes layer i = words[j] & 255 and horizontal coordinate x = uniforms[j] * width[i],
+ * it is accepted if uniforms[j] < ratio[i], i.e. if x is under the next layer
+ * @param words random words
+ * @param uniforms standard uniform variates
+ * @param size amount of candidates
+ * @param width width of 256 layers
+ * @param ratio ratio of the width of the next layer to the width of the current one
+ * @param symmetric if true, bit 8 of the word gives the sign of x
+ * @param output x of all candidates, accepted or not
+ * @param rejected indices of rejected candidates in increasing order
+ * @return amount of rejected candidates
+ */
+size_t zigguratLayers(const unsigned long long *words, const double *uniforms, size_t size,
+                      const double *width, const double *ratio, bool symmetric,
+                      double *output, size_t *rejected);
+
+/**
+ * @fn zigguratLayers
+ * single-precision version, the whole candidate is taken from one 32-bit word:
+ * layer i = words[j] & 255, bit 8 gives the sign if symmetric
+ * and uniform variate is (k + 0.5) * 2^-23 for k = words[j] >> 9
+ * @param words 32-bit random words
+ * @param size amount of candidates
+ * @param width width of 256 layers
+ * @param ratio ratio of the width of the next layer to the width of the current one
+ * @param symmetric
+ * @param output x of all candidates, accepted or not
+ * @param rejected indices of rejected candidates in increasing order
+ * @return amount of rejected candidates
+ */
+size_t zigguratLayers(const unsigned int *words, size_t size,
+                      const float *width, const float *ratio, bool symmetric,
+                      float *output, size_t *rejected);
+
+/**
+ * @fn marsagliaTsangSqueeze
+ * squeeze test of Marsaglia-Tsang method for a block of candidates:
+ * j-th candidate is v = (1 + c * normals[j])^3, it is accepted if v > 0 and uniforms[j] < 1 - squeeze * normals[j]^4
+ * @param normals standard normal variates
+ * @param uniforms standard uniform variates
+ * @param size amount of candidates
+ * @param c 1 / (3 * sqrt(α - 1/3))
+ * @param squeeze coefficient of the squeeze
+ * @param output v of all candidates, accepted or not
+ * @param rejected indices of rejected candidates in increasing order
+ * @return amount of rejected candidates
+ */
+size_t marsagliaTsangSqueeze(const double *normals, const double *uniforms, size_t size, double c, double squeeze,
+                             double *output, size_t *rejected);
+
+/**
+ * @brief The SinglePrecisionTable struct
+ * compile-time copy of a table in single precision
+ */
+template <size_t N>
+struct SinglePrecisionTable
+{
+    alignas(64) float value[N];
+
+    constexpr explicit SinglePrecisionTable(const double (&table)[N]) : value()
+    {
+        for (size_t i = 0; i != N; ++i)
+            value[i] = static_cast<float>(table[i]);
+    }
+};
+
+}
+
+#endif // VECTORMATH_H
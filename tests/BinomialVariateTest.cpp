@@ -0,0 +1,27 @@
+#include "TestUtils.h"
+
+/// sampler with per-call parameters fits binomial distribution for small and large mean
+
+int main()
+{
+    RandGenerator generator;
+    generator.Reseed(1);
+    const std::pair<int, double> parameters[] = {{10, 0.3}, {100, 0.099}, {100, 0.1}, {40, 0.5},
+                                                 {1000, 0.8}, {100000, 0.02}, {1000000, 0.5}};
+    for (const auto &parameter : parameters) {
+        int number = parameter.first;
+        double probability = parameter.second;
+        std::vector<int> sample(50000);
+        for (int &var : sample) {
+            var = BinomialDistribution::Variate(number, probability, generator);
+            CHECK(var >= 0 && var <= number);
+        }
+        CHECK(RandLibTest::fitsDiscrete(BinomialRand(number, probability), sample));
+    }
+
+    /// degenerate cases
+    CHECK(BinomialDistribution::Variate(50, 0.0, generator) == 0);
+    CHECK(BinomialDistribution::Variate(50, 1.0, generator) == 50);
+
+    return RandLibTest::result("BinomialVariateTest");
+}
@@ -0,0 +1,73 @@
+#include "TestUtils.h"
+
+/// buffered adapter hands out the same words as its engine
+
+namespace
+{
+
+template <class Engine, size_t N>
+void checkBuffered(unsigned long seed)
+{
+    BufferedRandGenerator<Engine, N> buffered;
+    buffered.Reseed(seed);
+    BasicRandGenerator<Engine> plain;
+    plain.Reseed(seed);
+    static_assert(alignof(BufferedRandGenerator<Engine, N>) >= 64, "buffer should be aligned on cache line");
+
+    /// single calls across refills, then bulk call from the middle of the buffer
+    for (size_t i = 0; i != 3 * N + 1; ++i)
+        CHECK(buffered.Next() == plain.Variate());
+    std::vector<unsigned long long> words(2 * N + 3);
+    buffered.Fill(words.data(), words.size());
+    for (unsigned long long word : words)
+        CHECK(word == plain.Variate());
+
+    /// skips inside the buffer and beyond it
+    for (unsigned long long n : {1ULL, N - 1ULL, 5 * N + 7ULL}) {
+        buffered.Discard(n);
+        plain.Discard(n);
+        CHECK(buffered.Next() == plain.Variate());
+    }
+    buffered.Jump(10);
+    plain.Jump(10);
+    CHECK(buffered.Next() == plain.Variate());
+}
+
+}
+
+int main()
+{
+    checkBuffered<JKissRandEngine, 64>(1);
+    checkBuffered<Xoshiro256RandEngine, 1024>(2);
+    checkBuffered<PhiloxRandEngine, 7>(3);
+
+    /// jumps beyond 2^63 words need jump-ahead of the engine
+    BufferedRandGenerator<SFC64RandEngine, 16> sfc;
+    bool thrown = false;
+    try {
+        sfc.Jump(64);
+    }
+    catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    BufferedRandGenerator<PCGRandEngine, 16> pcg;
+    pcg.Reseed(4);
+    PCGRandEngine engine;
+    engine.Reseed(4);
+    pcg.Next();
+    engine.Next();
+    pcg.Jump(70);
+    engine.Jump(70);
+    CHECK(pcg.Next() == engine.Next());
+
+    /// distributions sample through the buffer
+    ExponentialRand X(2);
+    X.SetEngine(RandGenerator(BufferedRandGenerator<PCGRandEngine, 256>()));
+    X.Reseed(5);
+    std::vector<double> sample(100000);
+    X.Sample(sample);
+    CHECK(RandLibTest::fitsContinuous(X, sample));
+
+    return RandLibTest::result("BufferedGeneratorTest");
+}
@@ -0,0 +1,66 @@
+#include "TestUtils.h"
+
+/// bulk calls give the same words and variates as calls one by one
+
+namespace
+{
+
+template <class Engine>
+void checkFill(unsigned long seed)
+{
+    BasicRandGenerator<Engine> bulk, single;
+    bulk.Reseed(seed);
+    single.Reseed(seed);
+    /// sizes, which are not multiples of the block, and the empty one
+    for (size_t size : {0, 1, 7, 255, 256, 1000}) {
+        std::vector<unsigned long long> words(size);
+        bulk.Fill(words.data(), size);
+        for (size_t i = 0; i != size; ++i)
+            CHECK(words[i] == single.Variate());
+    }
+}
+
+template <class Engine>
+void checkFillUniform(unsigned long seed, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+{
+    BasicRandGenerator<Engine> bulk, single;
+    bulk.Reseed(seed);
+    single.Reseed(seed);
+    for (size_t size : {1, 129, 300}) {
+        std::vector<double> variates(size);
+        bulk.FillUniform(variates.data(), size, interval, resolution);
+        for (size_t i = 0; i != size; ++i)
+            CHECK(variates[i] == single.UniformVariate(interval, resolution));
+    }
+}
+
+template <class Engine>
+void checkAllConversions(unsigned long seed)
+{
+    for (UNIFORM_INTERVAL interval : {OPEN_INTERVAL, HALF_OPEN_INTERVAL, CLOSED_INTERVAL})
+        for (UNIFORM_RESOLUTION resolution : {RESOLUTION_32, RESOLUTION_53})
+            checkFillUniform<Engine>(seed, interval, resolution);
+}
+
+}
+
+int main()
+{
+    checkFill<JKissRandEngine>(1);
+    checkFill<JLKiss64RandEngine>(2);
+    checkFill<PCGRandEngine>(3);
+    /// 53-bit variates of 32-bit engines take two words
+    checkAllConversions<JKissRandEngine>(4);
+    checkAllConversions<JLKiss64RandEngine>(5);
+    checkAllConversions<PCGRandEngine>(6);
+
+    RandGenerator bulk{PCGRandEngine()}, single{PCGRandEngine()};
+    bulk.Reseed(7);
+    single.Reseed(7);
+    std::vector<double> variates(1000);
+    bulk.FillUniform(variates.data(), variates.size());
+    for (double variate : variates)
+        CHECK(variate == single.UniformVariate());
+
+    return RandLibTest::result("BulkFillTest");
+}
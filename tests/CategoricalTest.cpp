@@ -0,0 +1,55 @@
+#include "TestUtils.h"
+#include <cmath>
+#include <numeric>
+
+/// alias table gives categorical variates, guide table gives the same quantiles as the binary search
+
+namespace
+{
+
+void checkCategorical(std::vector<double> probabilities, unsigned long seed)
+{
+    std::vector<double> cumulative(probabilities.size());
+    std::partial_sum(probabilities.begin(), probabilities.end(), cumulative.begin());
+    CategoricalRand X(std::move(probabilities));
+    X.Reseed(seed);
+    std::vector<int> sample(50000);
+    X.Sample(sample);
+    CHECK(RandLibTest::fitsDiscrete(X, sample));
+    for (int &var : sample) {
+        var = X.Variate();
+        CHECK(X.P(var) > 0.0);
+    }
+    CHECK(RandLibTest::fitsDiscrete(X, sample));
+
+    for (int i = 1; i != 1000; ++i) {
+        double p = 0.001 * i;
+        int k = std::lower_bound(cumulative.begin(), cumulative.end(), p * (1 - 1e-12)) - cumulative.begin();
+        /// quantile might differ only on the border of the cumulative sum
+        int quantile = X.Quantile(p);
+        CHECK(quantile == k || RandLibTest::isClose(cumulative[std::min(k, quantile)], p, 1e-9));
+    }
+}
+
+}
+
+int main()
+{
+    checkCategorical({0.2, 0.3, 0.5}, 1);
+    checkCategorical({0.0, 0.25, 0.0, 0.75, 0.0}, 2);
+    checkCategorical({0.999, 0.001}, 3);
+
+    /// geometric weights over many outcomes: columns of the alias table are filled by several large ones
+    std::vector<double> geometric(300);
+    double sum = 0;
+    for (size_t k = 0; k != geometric.size(); ++k)
+        sum += geometric[k] = std::pow(0.98, k);
+    for (double &p : geometric)
+        p /= sum;
+    checkCategorical(std::move(geometric), 4);
+
+    std::vector<double> uniform(1000, 0.001);
+    checkCategorical(std::move(uniform), 5);
+
+    return RandLibTest::result("CategoricalTest");
+}
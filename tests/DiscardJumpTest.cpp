@@ -0,0 +1,84 @@
+#include "TestUtils.h"
+
+/// fast Discard(n) and Jump(k) land on the same word as stepping
+
+namespace
+{
+
+template <class Engine>
+bool sameState(Engine a, Engine b)
+{
+    for (int i = 0; i != 16; ++i) {
+        if (a.Next() != b.Next())
+            return false;
+    }
+    return true;
+}
+
+template <class Engine>
+void checkDiscard(unsigned long seed)
+{
+    static_assert(HasDiscard<Engine>::value && HasJump<Engine>::value, "engine should skip words in O(log(n))");
+    Engine engine;
+    engine.Reseed(seed);
+    Engine stepped = engine;
+    std::vector<unsigned long long> words(70000);
+    for (unsigned long long &word : words)
+        word = stepped.Next();
+
+    for (unsigned long long n : {0, 1, 2, 63, 64, 1000, 65535, 65536}) {
+        Engine skipped = engine;
+        skipped.Discard(n);
+        CHECK(skipped.Next() == words[n]);
+    }
+    for (unsigned int k : {0, 1, 7, 16}) {
+        Engine jumped = engine;
+        jumped.Jump(k);
+        CHECK(jumped.Next() == words[1ULL << k]);
+    }
+
+    /// far skips are consistent with each other
+    Engine a = engine, b = engine, c = engine;
+    a.Discard(123456789012345ULL);
+    b.Discard(123456789000000ULL);
+    b.Discard(12345ULL);
+    CHECK(sameState(a, b));
+    a = engine;
+    a.Jump(80);
+    b = engine;
+    b.Jump(79);
+    b.Jump(79);
+    CHECK(sameState(a, b));
+    c.Jump(40);
+    a = engine;
+    a.Discard(1ULL << 40);
+    CHECK(sameState(a, c));
+}
+
+}
+
+int main()
+{
+    checkDiscard<JKissRandEngine>(1);
+    checkDiscard<JLKiss64RandEngine>(2);
+    checkDiscard<PCGRandEngine>(3);
+
+    /// engines without fast discard generate and drop the words, jump is limited by 2^63
+    BasicRandGenerator<SFC64RandEngine> generator, stepped;
+    generator.Reseed(4);
+    stepped.Reseed(4);
+    generator.Discard(1000);
+    for (int i = 0; i != 1000; ++i)
+        stepped.Variate();
+    CHECK(generator.Variate() == stepped.Variate());
+    bool thrown = false;
+    try {
+        generator.Jump(64);
+    }
+    catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return RandLibTest::result("DiscardJumpTest");
+}
@@ -0,0 +1,74 @@
+#include "TestUtils.h"
+
+/// engine is chosen per generator and per distribution at runtime
+
+namespace
+{
+
+unsigned long long savedTag(const RandGenerator &generator)
+{
+    std::stringstream state;
+    generator.SaveState(state);
+    unsigned long long header[2] = {0, 0};
+    state.read(reinterpret_cast<char *>(header), sizeof(header));
+    return header[1];
+}
+
+template <class Engine>
+void checkGenerator(unsigned long seed)
+{
+    Engine engine;
+    engine.Reseed(seed);
+    RandGenerator generator(engine);
+    CHECK(generator.MaxValue() == Engine::MaxValue());
+    CHECK(savedTag(generator) == EngineStateTag<Engine>::value);
+    for (int i = 0; i != 100; ++i)
+        CHECK(generator.Variate() == engine.Next());
+
+    /// copy continues the same sequence independently
+    RandGenerator copy = generator;
+    std::vector<unsigned long long> words(100);
+    copy.Fill(words.data(), words.size());
+    for (unsigned long long word : words)
+        CHECK(generator.Variate() == word);
+
+    /// new engine of the same type is seeded randomly
+    RandGenerator spawned;
+    spawned.SetEngine(generator);
+    CHECK(savedTag(spawned) == EngineStateTag<Engine>::value);
+    CHECK(spawned.Variate() != generator.Variate());
+}
+
+}
+
+int main()
+{
+    checkGenerator<JKissRandEngine>(1);
+    checkGenerator<PCGRandEngine>(2);
+    checkGenerator<SFC64RandEngine>(3);
+    checkGenerator<PhiloxRandEngine>(4);
+
+    /// distribution with another engine samples correctly, its copies keep the engine
+    GammaRand X(2.5, 1.5);
+    X.SetEngine(RandGenerator(WyRandEngine()));
+    X.Reseed(5);
+    std::stringstream state;
+    X.SaveState(state);
+    unsigned long long header[2] = {0, 0};
+    state.read(reinterpret_cast<char *>(header), sizeof(header));
+    CHECK(header[1] == WyRandEngine::STATE_TAG);
+    std::vector<double> sample(100000);
+    X.Sample(sample);
+    CHECK(RandLibTest::fitsContinuous(X, sample));
+    GammaRand Y = X;
+    CHECK(Y.Variate() == X.Variate());
+
+    PoissonRand Z(3.5);
+    Z.SetEngine(RandGenerator(Xoshiro256RandEngine()));
+    Z.Reseed(6);
+    std::vector<int> counts(100000);
+    Z.Sample(counts);
+    CHECK(RandLibTest::fitsDiscrete(Z, counts));
+
+    return RandLibTest::result("EngineChoiceTest");
+}
@@ -0,0 +1,39 @@
+#include "TestUtils.h"
+#include <cmath>
+
+/// batch ziggurat gives exponential variates, including the tail beyond the base layer
+
+int main()
+{
+    ExponentialRand X(0.25);
+    X.Reseed(1);
+    for (size_t size : {1, 7, 33, 100001}) {
+        std::vector<double> sample(size);
+        X.Sample(sample);
+        for (double var : sample)
+            CHECK(var >= 0.0);
+        if (size > 100)
+            CHECK(RandLibTest::fitsContinuous(X, sample));
+    }
+
+    /// tail beyond 8: probability is 3.35e-4
+    ExponentialRand standard(1);
+    standard.Reseed(2);
+    std::vector<double> sample(1000000);
+    standard.Sample(sample);
+    int tail = 0;
+    for (double var : sample)
+        tail += (var > 8);
+    double expected = sample.size() * std::exp(-8);
+    CHECK(RandLibTest::isClose(tail, expected, 5 * std::sqrt(expected)));
+
+    /// memorylessness: excess over the threshold is exponential again
+    std::vector<double> excess;
+    for (double var : sample) {
+        if (var > 2)
+            excess.push_back(var - 2);
+    }
+    CHECK(RandLibTest::fitsContinuous(standard, excess));
+
+    return RandLibTest::result("ExponentialSampleTest");
+}
@@ -0,0 +1,28 @@
+#include "TestUtils.h"
+
+/// batch Marsaglia-Tsang sampler fits gamma distribution for shapes below and above 1
+
+int main()
+{
+    for (double shape : {0.3, 0.5, 0.8, 1.3, 5.0, 40.0}) {
+        GammaRand X(shape, 2);
+        X.Reseed(static_cast<unsigned long>(10 * shape));
+        std::vector<double> sample(20000);
+        X.Sample(sample);
+        CHECK(*std::min_element(sample.begin(), sample.end()) > 0.0);
+        CHECK(RandLibTest::fitsContinuous(X, sample));
+        for (double &var : sample)
+            var = X.Variate();
+        CHECK(RandLibTest::fitsContinuous(X, sample));
+    }
+
+    /// per-call shape and rate
+    RandGenerator generator;
+    generator.Reseed(1);
+    std::vector<double> sample(20000);
+    for (double &var : sample)
+        var = GammaRand::Variate(0.6, 4, generator);
+    CHECK(RandLibTest::fitsContinuous(GammaRand(0.6, 4), sample));
+
+    return RandLibTest::result("GammaSampleTest");
+}
@@ -0,0 +1,54 @@
+#include "TestUtils.h"
+
+/// long samples of discrete distributions go through cached guide table, which follows changes of parameters
+
+namespace
+{
+
+void checkSample(const DiscreteDistribution &distribution, unsigned long seed, int upper = INT_MAX)
+{
+    distribution.Reseed(seed);
+    std::vector<int> sample(50000);
+    distribution.Sample(sample);
+    for (int var : sample)
+        CHECK(var >= distribution.MinValue() && var <= distribution.MaxValue());
+    CHECK(RandLibTest::fitsDiscrete(distribution, sample, 1e-3, upper));
+    /// short samples are generated by Variate()
+    std::vector<int> shortSample(100);
+    distribution.Sample(shortSample);
+    for (int var : shortSample)
+        CHECK(var >= distribution.MinValue() && var <= distribution.MaxValue());
+}
+
+}
+
+int main()
+{
+    /// heavy tails, most of which lie outside of the table
+    ZetaRand zeta(1.5);
+    checkSample(zeta, 1, 1000);
+    zeta.SetExponent(3);
+    checkSample(zeta, 2, 1000);
+
+    YuleRand yule(1.2);
+    checkSample(yule, 3, 1000);
+    yule.SetShape(4);
+    checkSample(yule, 4, 1000);
+
+    LogarithmicRand logarithmic(0.99);
+    checkSample(logarithmic, 5);
+    logarithmic.SetProbability(0.3);
+    checkSample(logarithmic, 6);
+
+    SkellamRand skellam(3, 7.5);
+    checkSample(skellam, 7);
+    skellam.SetRates(40, 1);
+    checkSample(skellam, 8);
+
+    BetaBinomialRand betaBinomial(30, 0.5, 2);
+    checkSample(betaBinomial, 9);
+    betaBinomial.SetParameters(500, 4, 4);
+    checkSample(betaBinomial, 10);
+
+    return RandLibTest::result("GuideTableTest");
+}
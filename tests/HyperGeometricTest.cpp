@@ -0,0 +1,35 @@
+#include "TestUtils.h"
+
+/// ratio-of-uniforms samplers fit hypergeometric and negative hypergeometric distributions
+
+namespace
+{
+
+void checkSample(const DiscreteDistribution &distribution, unsigned long seed)
+{
+    distribution.Reseed(seed);
+    std::vector<int> sample(50000);
+    distribution.Sample(sample);
+    for (int var : sample)
+        CHECK(var >= distribution.MinValue() && var <= distribution.MaxValue());
+    CHECK(RandLibTest::fitsDiscrete(distribution, sample));
+}
+
+}
+
+int main()
+{
+    /// total size, draws, successes
+    checkSample(HyperGeometricRand(20, 5, 7), 1);
+    checkSample(HyperGeometricRand(1000, 900, 100), 2);
+    checkSample(HyperGeometricRand(100000, 3000, 40000), 3);
+    checkSample(HyperGeometricRand(1000000, 500000, 500000), 4);
+
+    /// total size, successes, limit of successes
+    checkSample(NegativeHyperGeometricRand(20, 7, 3), 5);
+    checkSample(NegativeHyperGeometricRand(1000, 10, 10), 6);
+    checkSample(NegativeHyperGeometricRand(100000, 30000, 50), 7);
+    checkSample(NegativeHyperGeometricRand(1000000, 900000, 500000), 8);
+
+    return RandLibTest::result("HyperGeometricTest");
+}
@@ -0,0 +1,44 @@
+#include "TestUtils.h"
+
+/// xoshiro256**, SFC64, wyrand and PCG64-DXSM give outputs of the reference implementations
+
+namespace
+{
+
+template <class Engine>
+void checkOutputs(std::vector<unsigned long long> state, std::vector<unsigned long long> expected)
+{
+    auto generator = RandLibTest::withState<Engine>(state.data(), state.size());
+    for (unsigned long long word : expected)
+        CHECK(generator.Variate() == word);
+}
+
+template <class Engine>
+void checkUniform(unsigned long seed)
+{
+    BasicRandGenerator<Engine> generator;
+    generator.Reseed(seed);
+    std::vector<double> sample(100000);
+    generator.FillUniform(sample.data(), sample.size(), OPEN_INTERVAL, RESOLUTION_53);
+    CHECK(RandLibTest::fitsContinuous(UniformRand(0, 1), sample));
+}
+
+}
+
+int main()
+{
+    /// reference outputs of http://prng.di.unimi.it/xoshiro256starstar.c for state {1, 2, 3, 4}
+    checkOutputs<Xoshiro256RandEngine>({1, 2, 3, 4}, {11520, 0, 1509978240, 1215971899390074240ULL});
+    /// a, b, c, counter
+    checkOutputs<SFC64RandEngine>({1, 2, 3, 4}, {0x7, 0x22, 0x1b000060});
+    checkOutputs<WyRandEngine>({1}, {0xcdef1695e1f8ed2cULL, 0x61d6d24b1c9aad40ULL, 0x8cf880c22eebfadfULL});
+    /// state = 2^64 + 2, inc = 3 * 2^64 + 5
+    checkOutputs<PCG64DXSMRandEngine>({1, 2, 3, 5}, {0x8fbc60c8ae988663ULL, 0x3abf26d9e4b8a030ULL, 0x21f93852fc7926feULL});
+
+    checkUniform<Xoshiro256RandEngine>(1);
+    checkUniform<SFC64RandEngine>(2);
+    checkUniform<WyRandEngine>(3);
+    checkUniform<PCG64DXSMRandEngine>(4);
+
+    return RandLibTest::result("ModernEnginesTest");
+}
@@ -0,0 +1,66 @@
+#include "TestUtils.h"
+
+/// every lane of MultiLaneRandEngine is xoshiro256**, words are handed out lane by lane
+
+namespace
+{
+
+template <size_t Lanes>
+void checkLanes()
+{
+    unsigned long long laneStates[Lanes][4], state[4 * Lanes];
+    for (size_t l = 0; l != Lanes; ++l) {
+        for (size_t j = 0; j != 4; ++j) {
+            laneStates[l][j] = 0x9E3779B97F4A7C15ULL * (4 * l + j + 1);
+            state[j * Lanes + l] = laneStates[l][j];
+        }
+    }
+    auto generator = RandLibTest::withState<MultiLaneRandEngine<Lanes>>(state, 4 * Lanes);
+    std::vector<BasicRandGenerator<Xoshiro256RandEngine>> lanes;
+    for (size_t l = 0; l != Lanes; ++l)
+        lanes.push_back(RandLibTest::withState<Xoshiro256RandEngine>(laneStates[l], 4));
+
+    /// single calls, then bulk calls from the middle of the step
+    for (int t = 0; t != 100; ++t)
+        for (size_t l = 0; l != Lanes; ++l)
+            CHECK(generator.Variate() == lanes[l].Variate());
+    CHECK(generator.Variate() == lanes[0].Variate());
+    std::vector<unsigned long long> words(1000 * Lanes - 1);
+    generator.Fill(words.data(), words.size());
+    for (size_t i = 0; i != words.size(); ++i)
+        CHECK(words[i] == lanes[(i + 1) % Lanes].Variate());
+}
+
+template <size_t Lanes>
+void checkFill(unsigned long seed)
+{
+    BasicRandGenerator<MultiLaneRandEngine<Lanes>> bulk, single;
+    bulk.Reseed(seed);
+    single.Reseed(seed);
+    for (size_t size : {size_t(3), size_t(1), Lanes, 4 * Lanes + 1, size_t(1000)}) {
+        std::vector<unsigned long long> words(size);
+        bulk.Fill(words.data(), size);
+        for (size_t i = 0; i != size; ++i)
+            CHECK(words[i] == single.Variate());
+    }
+}
+
+}
+
+int main()
+{
+    checkLanes<4>();
+    checkLanes<8>();
+    checkLanes<16>();
+    checkFill<4>(1);
+    checkFill<8>(2);
+    checkFill<16>(3);
+
+    BasicRandGenerator<MultiLaneRandEngine<8>> generator;
+    generator.Reseed(4);
+    std::vector<double> sample(100000);
+    generator.FillUniform(sample.data(), sample.size());
+    CHECK(RandLibTest::fitsContinuous(UniformRand(0, 1), sample));
+
+    return RandLibTest::result("MultiLaneTest");
+}
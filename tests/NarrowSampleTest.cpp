@@ -0,0 +1,53 @@
+#include "TestUtils.h"
+
+/// single-precision and narrow-integer samples follow the same distributions as the wide ones
+
+namespace
+{
+
+void checkFloat(const ContinuousDistribution &distribution, unsigned long seed)
+{
+    distribution.Reseed(seed);
+    /// overloads in single precision are reached through the base class
+    std::vector<float> sample(100000);
+    distribution.Sample(sample);
+    CHECK(RandLibTest::fitsContinuous(distribution, std::vector<double>(sample.begin(), sample.end())));
+}
+
+template <typename IntType, class Distribution>
+void checkNarrow(const Distribution &distribution, unsigned long seed)
+{
+    distribution.Reseed(seed);
+    std::vector<IntType> sample(100000);
+    distribution.Sample(sample);
+    CHECK(RandLibTest::fitsDiscrete(distribution, std::vector<int>(sample.begin(), sample.end())));
+}
+
+}
+
+int main()
+{
+    checkFloat(NormalRand(-1, 0.25), 1);
+    checkFloat(ExponentialRand(3), 2);
+    checkFloat(UniformRand(-2, 5), 3);
+    checkFloat(GammaRand(0.7, 2), 4);
+    checkFloat(BetaRand(2, 3), 5);
+
+    checkNarrow<uint8_t>(BernoulliRand(0.3), 6);
+    checkNarrow<uint16_t>(BernoulliRand(0.9), 7);
+    checkNarrow<uint8_t>(BinomialRand(20, 0.4), 8);
+    checkNarrow<uint8_t>(BinomialRand(255, 0.9), 9);
+    checkNarrow<uint16_t>(BinomialRand(1000, 0.2), 10);
+
+    bool thrown = false;
+    try {
+        std::vector<uint8_t> sample(10);
+        BinomialRand(256, 0.5).Sample(sample);
+    }
+    catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return RandLibTest::result("NarrowSampleTest");
+}
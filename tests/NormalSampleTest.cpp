@@ -0,0 +1,33 @@
+#include "TestUtils.h"
+#include <cmath>
+
+/// batch ziggurat gives normal variates, including the tail beyond the base layer
+
+int main()
+{
+    NormalRand X(2, 9);
+    X.Reseed(1);
+    /// sizes, which leave a tail after the last full SIMD register
+    for (size_t size : {1, 5, 17, 100003}) {
+        std::vector<double> sample(size);
+        X.Sample(sample);
+        if (size > 100)
+            CHECK(RandLibTest::fitsContinuous(X, sample));
+    }
+
+    /// tail beyond 3.7: probability is 2.16e-4, expected count in 1e6 variates has standard deviation below 15
+    const size_t size = 1000000;
+    std::vector<double> standard(size);
+    RandGenerator generator;
+    generator.Reseed(2);
+    NormalRand::StandardSample(standard.data(), size, generator);
+    int tail = 0;
+    for (double var : standard)
+        tail += (std::fabs(var) > 3.7);
+    double expected = size * 2 * NormalRand(0, 1).S(3.7);
+    CHECK(RandLibTest::isClose(tail, expected, 5 * std::sqrt(expected)));
+    standard.resize(100000);
+    CHECK(RandLibTest::fitsContinuous(NormalRand(0, 1), standard));
+
+    return RandLibTest::result("NormalSampleTest");
+}
@@ -0,0 +1,54 @@
+#include "TestUtils.h"
+#include <cmath>
+
+/// interpolated quantile function keeps u-error below the resolution, variates fit the distribution
+
+namespace
+{
+
+double maxUError(const ContinuousDistribution &distribution, const NumericalInversion &inversion)
+{
+    double maxError = 0;
+    const int size = 20000;
+    for (int i = 0; i != size; ++i) {
+        double u = (i + 0.5) / size;
+        maxError = std::max(maxError, std::fabs(distribution.F(inversion.Quantile(u)) - u));
+    }
+    for (double u : {1e-9, 1e-6, 1 - 1e-6, 1 - 1e-9})
+        maxError = std::max(maxError, std::fabs(distribution.F(inversion.Quantile(u)) - u));
+    return maxError;
+}
+
+void checkInversion(const ContinuousDistribution &distribution, double resolution,
+                    NumericalInversion::INVERSION_INPUT input, unsigned long seed)
+{
+    NumericalInversion inversion(distribution, resolution, input);
+    double error = maxUError(distribution, inversion);
+    CHECK(error <= resolution);
+
+    /// quantile is monotone
+    double previous = inversion.Quantile(1e-6);
+    for (int i = 1; i != 1000; ++i) {
+        double x = inversion.Quantile(1e-6 + i * (1 - 2e-6) / 1000);
+        CHECK(x >= previous);
+        previous = x;
+    }
+
+    inversion.Reseed(seed);
+    std::vector<double> sample(50000);
+    inversion.Sample(sample);
+    CHECK(RandLibTest::fitsContinuous(distribution, sample));
+}
+
+}
+
+int main()
+{
+    using NI = NumericalInversion;
+    checkInversion(NormalRand(1, 4), 1e-10, NI::DENSITY_INPUT, 1);
+    checkInversion(GammaRand(3, 2), 1e-10, NI::DENSITY_INPUT, 2);
+    checkInversion(BetaRand(2, 5), 1e-12, NI::DENSITY_INPUT, 3);
+    checkInversion(CauchyRand(0, 1), 1e-8, NI::CDF_INPUT, 4);
+    checkInversion(LogNormalRand(0, 1), 1e-10, NI::CDF_INPUT, 5);
+    return RandLibTest::result("NumericalInversionTest");
+}
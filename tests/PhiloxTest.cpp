@@ -0,0 +1,64 @@
+#include "TestUtils.h"
+
+/// Philox4x32-10 gives known outputs and random access to them
+
+int main()
+{
+    /// known answer of Random123 for zero key and zero counter: 6627e8d5 e169c58d bc57ac4c 9b00dbd8
+    const unsigned long long zeroState[3] = {0, 0, 0}; /// key, stream, index
+    auto zero = RandLibTest::withState<PhiloxRandEngine>(zeroState, 3);
+    CHECK(zero.Variate() == 0xe169c58d6627e8d5ULL);
+    CHECK(zero.Variate() == 0x9b00dbd8bc57ac4cULL);
+
+    PhiloxRandEngine engine;
+    engine.Reseed(1);
+    PhiloxRandEngine stepped = engine;
+    std::vector<unsigned long long> words(5000);
+    for (unsigned long long &word : words)
+        word = stepped.Next();
+
+    /// random access doesn't change the position
+    for (size_t i : {0, 1, 2, 777, 4999})
+        CHECK(engine.Output(i) == words[i]);
+    CHECK(engine.Position() == 0);
+
+    /// discard from even and odd positions
+    for (unsigned long long n : {0, 1, 2, 3, 100, 1001}) {
+        PhiloxRandEngine skipped = engine;
+        skipped.Next();
+        skipped.Discard(n);
+        CHECK(skipped.Position() == n + 1);
+        CHECK(skipped.Next() == words[n + 1]);
+        CHECK(skipped.Next() == words[n + 2]);
+    }
+
+    /// jump on 2^k outputs is the same as discard of them
+    for (unsigned int k : {0, 1, 5, 12}) {
+        BasicRandGenerator<PhiloxRandEngine> jumped(engine);
+        jumped.Variate();
+        jumped.Jump(k);
+        CHECK(jumped.Variate() == words[(1ULL << k) + 1]);
+    }
+    PhiloxRandEngine far = engine;
+    far.Jump(40);
+    CHECK(far.Position() == (1ULL << 40));
+    CHECK(far.Next() == engine.Output(1ULL << 40));
+
+    /// bulk calls from odd position
+    PhiloxRandEngine bulk = engine;
+    bulk.Next();
+    std::vector<unsigned long long> filled(1001);
+    bulk.Fill(filled.data(), filled.size());
+    for (size_t i = 0; i != filled.size(); ++i)
+        CHECK(filled[i] == words[i + 1]);
+
+    /// streams with the same root seed are different
+    auto first = BasicRandGenerator<PhiloxRandEngine>::Stream(1, 0);
+    auto second = BasicRandGenerator<PhiloxRandEngine>::Stream(1, 1);
+    int equal = 0;
+    for (int i = 0; i != 1000; ++i)
+        equal += (first.Variate() == second.Variate());
+    CHECK(equal == 0);
+
+    return RandLibTest::result("PhiloxTest");
+}
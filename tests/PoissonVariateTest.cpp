@@ -0,0 +1,27 @@
+#include "TestUtils.h"
+
+/// sampler with per-call rate fits Poisson distribution on both sides of the switch to transformed rejection
+
+int main()
+{
+    RandGenerator generator;
+    generator.Reseed(1);
+    for (double rate : {0.5, 9.5, 10.0, 37.3, 100.0, 10000.0}) {
+        std::vector<int> sample(50000);
+        for (int &var : sample)
+            var = PoissonRand::Variate(rate, generator);
+        CHECK(RandLibTest::fitsDiscrete(PoissonRand(rate), sample));
+    }
+
+    /// rate changes with every call
+    std::vector<int> sample(50000);
+    for (size_t i = 0; i != sample.size(); ++i)
+        sample[i] = PoissonRand::Variate((i & 1) ? 3.0 : 300.0, generator);
+    std::vector<int> low, high;
+    for (size_t i = 0; i != sample.size(); ++i)
+        ((i & 1) ? low : high).push_back(sample[i]);
+    CHECK(RandLibTest::fitsDiscrete(PoissonRand(3), low));
+    CHECK(RandLibTest::fitsDiscrete(PoissonRand(300), high));
+
+    return RandLibTest::result("PoissonVariateTest");
+}
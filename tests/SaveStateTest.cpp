@@ -0,0 +1,89 @@
+#include "TestUtils.h"
+
+/// sampling resumes from the saved state
+
+namespace
+{
+
+template <class Generator>
+void checkGenerator(Generator &generator)
+{
+    std::stringstream state;
+    generator.SaveState(state);
+    std::vector<unsigned long long> words(1000);
+    generator.Fill(words.data(), 999);
+    words[999] = generator.Variate();
+    generator.LoadState(state);
+    CHECK(!state.fail());
+    for (unsigned long long word : words)
+        CHECK(generator.Variate() == word);
+}
+
+template <class Engine>
+void checkEngine(unsigned long seed)
+{
+    BasicRandGenerator<Engine> generator;
+    generator.Reseed(seed);
+    /// state in the middle of the buffer or of the block
+    for (int i = 0; i != 3; ++i)
+        generator.Variate();
+    checkGenerator(generator);
+}
+
+template <class Distribution>
+void checkDistribution(const Distribution &distribution, unsigned long seed)
+{
+    distribution.Reseed(seed);
+    distribution.Variate();
+    std::stringstream state;
+    distribution.SaveState(state);
+    std::vector<typename std::decay<decltype(distribution.Variate())>::type> sample(1000), resumed(1000);
+    distribution.Sample(sample);
+    auto var = distribution.Variate();
+    distribution.LoadState(state);
+    CHECK(!state.fail());
+    distribution.Sample(resumed);
+    CHECK(resumed == sample);
+    CHECK(distribution.Variate() == var);
+}
+
+}
+
+int main()
+{
+    checkEngine<JKissRandEngine>(1);
+    checkEngine<JLKiss64RandEngine>(2);
+    checkEngine<PCGRandEngine>(3);
+    checkEngine<PhiloxRandEngine>(4);
+    checkEngine<MultiLaneRandEngine<4>>(5);
+    checkEngine<Xoshiro256RandEngine>(6);
+    checkEngine<SFC64RandEngine>(7);
+    checkEngine<WyRandEngine>(8);
+    checkEngine<PCG64DXSMRandEngine>(9);
+    checkEngine<BufferedRandGenerator<PCGRandEngine, 64>>(10);
+
+    RandGenerator defaultGenerator, sfcGenerator{SFC64RandEngine()};
+    checkGenerator(defaultGenerator);
+    checkGenerator(sfcGenerator);
+
+    /// state of another engine is refused and the engine is left untouched
+    std::stringstream state;
+    defaultGenerator.SaveState(state);
+    RandGenerator copy = sfcGenerator;
+    sfcGenerator.LoadState(state);
+    CHECK(state.fail());
+    for (int i = 0; i != 10; ++i)
+        CHECK(sfcGenerator.Variate() == copy.Variate());
+    std::stringstream truncated(std::string(10, '\0'));
+    defaultGenerator.LoadState(truncated);
+    CHECK(truncated.fail());
+
+    /// distributions with several generators save all of them
+    checkDistribution(NormalRand(1, 2), 11);
+    checkDistribution(StudentTRand(3), 12);
+    checkDistribution(BetaRand(0.5, 2), 13);
+    checkDistribution(BinomialRand(50, 0.3), 14);
+    checkDistribution(NegativeBinomialRand<int>(5, 0.4), 15);
+
+    return RandLibTest::result("SaveStateTest");
+}
@@ -0,0 +1,73 @@
+#include "TestUtils.h"
+
+/// engines are called directly by BasicRandGenerator, without virtual calls
+
+namespace
+{
+
+struct NotAnEngine
+{
+    unsigned long long Next() { return 0; }
+};
+
+static_assert(IsRandEngine<JKissRandEngine>::value, "JKiss should satisfy engine interface");
+static_assert(IsRandEngine<JLKiss64RandEngine>::value, "JLKiss64 should satisfy engine interface");
+static_assert(IsRandEngine<PCGRandEngine>::value, "PCG should satisfy engine interface");
+static_assert(!IsRandEngine<NotAnEngine>::value, "class without engine interface should be rejected");
+static_assert(!std::is_polymorphic<JKissRandEngine>::value, "engines should not have virtual functions");
+static_assert(!std::is_polymorphic<PCGRandEngine>::value, "engines should not have virtual functions");
+
+template <class Engine>
+void checkSameSequence(unsigned long seed)
+{
+    Engine engine;
+    engine.Reseed(seed);
+    BasicRandGenerator<Engine> generator(engine);
+    for (int i = 0; i != 1000; ++i)
+        CHECK(generator.Variate() == engine.Next());
+}
+
+template <class Engine>
+void checkUniformMean(unsigned long seed)
+{
+    BasicRandGenerator<Engine> generator;
+    generator.Reseed(seed);
+    const int size = 100000;
+    double sum = 0;
+    for (int i = 0; i != size; ++i) {
+        double u = generator.UniformVariate();
+        CHECK(u > 0.0 && u < 1.0);
+        sum += u;
+    }
+    /// standard deviation of the mean is 1 / sqrt(12 * size) < 0.001
+    CHECK(RandLibTest::isClose(sum / size, 0.5, 0.005));
+}
+
+}
+
+int main()
+{
+    checkSameSequence<JKissRandEngine>(1);
+    checkSameSequence<JLKiss64RandEngine>(2);
+    checkSameSequence<PCGRandEngine>(3);
+    checkUniformMean<JKissRandEngine>(4);
+    checkUniformMean<JLKiss64RandEngine>(5);
+    checkUniformMean<PCGRandEngine>(6);
+
+    /// RandGenerator without chosen engine calls the default one directly
+    RandGenerator generator;
+    DefaultRandGenerator defaultGenerator;
+    generator.Reseed(7);
+    defaultGenerator.Reseed(7);
+    for (int i = 0; i != 1000; ++i)
+        CHECK(generator.Variate() == defaultGenerator.Variate());
+
+    /// distributions sample through the same generator
+    NormalRand X(1, 4);
+    X.Reseed(8);
+    std::vector<double> sample(100000);
+    X.Sample(sample);
+    CHECK(RandLibTest::fitsContinuous(X, sample));
+
+    return RandLibTest::result("StaticDispatchTest");
+}
@@ -0,0 +1,37 @@
+#include "TestUtils.h"
+
+/// ziggurat tables are constants, so sampling works during dynamic initialization of other translation units
+
+namespace
+{
+
+struct EarlySample
+{
+    std::vector<double> normal = std::vector<double>(100000);
+    std::vector<double> exponential = std::vector<double>(100000);
+    std::vector<double> batch = std::vector<double>(100000);
+
+    EarlySample()
+    {
+        RandGenerator generator;
+        generator.Reseed(1);
+        for (double &var : normal)
+            var = NormalRand::StandardVariate(generator);
+        for (double &var : exponential)
+            var = ExponentialRand::StandardVariate(generator);
+        NormalRand::StandardSample(batch.data(), batch.size(), generator);
+    }
+};
+
+/// initialized before main(), in unspecified order relative to static objects of the library
+const EarlySample earlySample;
+
+}
+
+int main()
+{
+    CHECK(RandLibTest::fitsContinuous(NormalRand(0, 1), earlySample.normal));
+    CHECK(RandLibTest::fitsContinuous(ExponentialRand(1), earlySample.exponential));
+    CHECK(RandLibTest::fitsContinuous(NormalRand(0, 1), earlySample.batch));
+    return RandLibTest::result("StaticInitTest");
+}
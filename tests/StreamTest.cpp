@@ -0,0 +1,81 @@
+#include "TestUtils.h"
+#include <cmath>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/// streams of one root seed are reproducible and independent, forked child doesn't repeat its parent
+
+namespace
+{
+
+template <class Engine>
+void checkStreams(unsigned long long rootSeed)
+{
+    const int streams = 8, size = 20000;
+    std::vector<std::vector<double>> variates(streams, std::vector<double>(size));
+    for (int id = 0; id != streams; ++id) {
+        auto generator = BasicRandGenerator<Engine>::Stream(rootSeed, id);
+        generator.FillUniform(variates[id].data(), size);
+        auto again = BasicRandGenerator<Engine>::Stream(rootSeed, id);
+        CHECK(again.UniformVariate() == variates[id][0]);
+    }
+    /// correlation of independent streams is about N(0, 1 / size)
+    for (int i = 0; i != streams; ++i) {
+        for (int j = 0; j != i; ++j) {
+            double sum = 0;
+            for (int k = 0; k != size; ++k)
+                sum += (variates[i][k] - 0.5) * (variates[j][k] - 0.5);
+            double correlation = 12 * sum / size;
+            CHECK(std::fabs(correlation) < 5.0 / std::sqrt(size));
+        }
+    }
+    /// another root seed gives another stream with the same id
+    auto other = BasicRandGenerator<Engine>::Stream(rootSeed + 1, 0);
+    CHECK(other.UniformVariate() != variates[0][0]);
+}
+
+void checkFork()
+{
+    NormalRand::StandardVariate();
+    int fd[2];
+    CHECK(pipe(fd) == 0);
+    pid_t pid = fork();
+    const int size = 4;
+    double variates[size];
+    for (double &variate : variates)
+        variate = NormalRand::StandardVariate();
+    if (pid == 0) {
+        ssize_t written = write(fd[1], variates, sizeof(variates));
+        _exit(written == sizeof(variates) ? 0 : 1);
+    }
+    CHECK(pid > 0);
+    double childVariates[size];
+    CHECK(read(fd[0], childVariates, sizeof(childVariates)) == sizeof(childVariates));
+    int status = 1;
+    waitpid(pid, &status, 0);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    close(fd[0]);
+    close(fd[1]);
+    /// static generator of the child is reseeded after fork
+    int equal = 0;
+    for (int i = 0; i != size; ++i)
+        equal += (variates[i] == childVariates[i]);
+    CHECK(equal == 0);
+}
+
+}
+
+int main()
+{
+    checkStreams<JKissRandEngine>(1);
+    checkStreams<JLKiss64RandEngine>(2);
+    checkStreams<PCGRandEngine>(3);
+    checkStreams<PhiloxRandEngine>(4);
+    checkStreams<Xoshiro256RandEngine>(5);
+    checkStreams<SFC64RandEngine>(6);
+    checkStreams<WyRandEngine>(7);
+    checkStreams<PCG64DXSMRandEngine>(8);
+    checkStreams<MultiLaneRandEngine<8>>(9);
+    checkFork();
+    return RandLibTest::result("StreamTest");
+}
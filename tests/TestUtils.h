@@ -0,0 +1,143 @@
+#ifndef TESTUTILS_H
+#define TESTUTILS_H
+
+#include "RandLib.h"
+#include <algorithm>
+#include <climits>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// Minimal checks for the tests: every test is an executable, which reports failed checks
+/// and returns non-zero if there were any. Generators are seeded explicitly,
+/// so statistical checks give the same result on each run
+
+namespace RandLibTest
+{
+
+inline int &failures()
+{
+    static int count = 0;
+    return count;
+}
+
+inline void check(bool condition, const char *expression, const char *file, int line)
+{
+    if (!condition) {
+        std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+        ++failures();
+    }
+}
+
+/**
+ * @fn result
+ * @param name
+ * @return exit code of the test
+ */
+inline int result(const char *name)
+{
+    if (failures() == 0) {
+        std::cout << name << ": passed" << std::endl;
+        return 0;
+    }
+    std::cout << name << ": " << failures() << " check(s) failed" << std::endl;
+    return 1;
+}
+
+/**
+ * @fn fitsContinuous
+ * @param distribution
+ * @param sample
+ * @param alpha level of the test
+ * @return true if Kolmogorov-Smirnov test doesn't reject the distribution
+ */
+inline bool fitsContinuous(const ContinuousDistribution &distribution, std::vector<double> sample, double alpha = 1e-3)
+{
+    std::sort(sample.begin(), sample.end());
+    return distribution.KolmogorovSmirnovTest(sample, alpha);
+}
+
+/**
+ * @fn fitsDiscrete
+ * Pearson's chi-squared test: neighbour values are pooled until expected count reaches 5,
+ * values above the upper bound form one cell
+ * @param distribution
+ * @param sample
+ * @param alpha level of the test
+ * @param upper upper bound of separate cells
+ * @return true if the test doesn't reject the distribution
+ */
+inline bool fitsDiscrete(const DiscreteDistribution &distribution, const std::vector<int> &sample,
+                         double alpha = 1e-3, int upper = INT_MAX)
+{
+    std::map<int, double> counts;
+    for (int var : sample)
+        ++counts[std::min(var, upper)];
+    double n = sample.size();
+    int minValue = counts.begin()->first, maxValue = counts.rbegin()->first;
+    std::vector<double> observed, expected;
+    double cellObserved = 0, cellExpected = n * distribution.F(minValue - 1);
+    for (int k = minValue; k <= maxValue; ++k) {
+        auto it = counts.find(k);
+        cellObserved += (it == counts.end()) ? 0.0 : it->second;
+        cellExpected += (k == maxValue) ? n * distribution.S(k - 1) : n * distribution.P(k);
+        if (cellExpected >= 5.0 || k == maxValue) {
+            observed.push_back(cellObserved);
+            expected.push_back(cellExpected);
+            cellObserved = cellExpected = 0;
+        }
+    }
+    if (expected.size() > 1 && expected.back() < 5.0) {
+        observed[observed.size() - 2] += observed.back();
+        expected[expected.size() - 2] += expected.back();
+        observed.pop_back();
+        expected.pop_back();
+    }
+    if (expected.size() < 2)
+        return false;
+    double statistic = 0;
+    for (size_t i = 0; i != expected.size(); ++i)
+        statistic += (observed[i] - expected[i]) * (observed[i] - expected[i]) / expected[i];
+    return statistic <= ChiSquaredRand(expected.size() - 1).Quantile1m(alpha);
+}
+
+/**
+ * @fn withState
+ * @param words first words of the state of the engine, in the order of its members
+ * @param size amount of words
+ * @return generator, whose engine has given state, the rest of the state is taken from the engine seeded by 0
+ */
+template <class Engine>
+BasicRandGenerator<Engine> withState(const unsigned long long *words, size_t size)
+{
+    BasicRandGenerator<Engine> generator;
+    generator.Reseed(0);
+    std::stringstream output;
+    generator.SaveState(output);
+    std::string state = output.str();
+    /// saved state starts from two words of the header
+    std::memcpy(&state[2 * sizeof(unsigned long long)], words, size * sizeof(unsigned long long));
+    std::istringstream input(state);
+    generator.LoadState(input);
+    return generator;
+}
+
+/**
+ * @fn isClose
+ * @param value
+ * @param expected
+ * @param tolerance absolute tolerance
+ * @return |value - expected| <= tolerance
+ */
+inline bool isClose(double value, double expected, double tolerance)
+{
+    return std::fabs(value - expected) <= tolerance;
+}
+
+}
+
+#define CHECK(condition) RandLibTest::check((condition), #condition, __FILE__, __LINE__)
+
+#endif // TESTUTILS_H
@@ -0,0 +1,52 @@
+#include "TestUtils.h"
+
+/// rejection from piecewise exponential hat reaches chosen ratio of hat and squeeze and fits the distribution
+
+namespace
+{
+
+void checkRejection(const ContinuousDistribution &distribution, double maxRatio, size_t maxPoints, unsigned long seed)
+{
+    TransformedDensityRejection sampler(distribution, maxRatio, maxPoints);
+    CHECK(sampler.GetRatio() >= 1.0 && sampler.GetRatio() <= maxRatio);
+    CHECK(sampler.GetNumberOfPoints() <= maxPoints);
+
+    sampler.Reseed(seed);
+    std::vector<double> sample(50000);
+    sampler.Sample(sample);
+    for (double var : sample)
+        CHECK(var >= distribution.MinValue() && var <= distribution.MaxValue());
+    CHECK(RandLibTest::fitsContinuous(distribution, sample));
+    for (double &var : sample)
+        var = sampler.Variate();
+    CHECK(RandLibTest::fitsContinuous(distribution, sample));
+}
+
+bool isRejected(const ContinuousDistribution &distribution)
+{
+    try {
+        TransformedDensityRejection sampler(distribution);
+    }
+    catch (const std::invalid_argument &) {
+        return true;
+    }
+    return false;
+}
+
+}
+
+int main()
+{
+    checkRejection(NormalRand(-3, 0.5), 1.01, 100, 1);
+    checkRejection(GammaRand(2.5, 1), 1.05, 100, 2);
+    /// mode at the boundary of the support
+    checkRejection(ExponentialRand(1.5), 1.01, 100, 3);
+    checkRejection(BetaRand(3, 1), 1.01, 100, 4);
+    checkRejection(BetaRand(2, 2), 1.1, 100, 5);
+
+    /// density should be log-concave
+    CHECK(isRejected(CauchyRand(0, 1)));
+    CHECK(isRejected(StudentTRand(3)));
+
+    return RandLibTest::result("TransformedDensityRejectionTest");
+}
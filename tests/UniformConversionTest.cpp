@@ -0,0 +1,55 @@
+#include "TestUtils.h"
+
+/// batch conversion of words into uniform variates gives the same values as one by one conversion
+
+namespace
+{
+
+void checkConversion(const std::vector<unsigned long long> &words, int shift32, UNIFORM_INTERVAL interval, UNIFORM_RESOLUTION resolution)
+{
+    /// every size checks the tail after the last full SIMD register
+    for (size_t size = 0; size <= words.size(); size += (size < 40) ? 1 : 97) {
+        std::vector<double> output(size);
+        UniformConversion::FromWords(words.data(), output.data(), size, shift32, interval, resolution);
+        for (size_t i = 0; i != size; ++i) {
+            double u = UniformConversion::FromWord(words[i], shift32, interval, resolution);
+            CHECK(output[i] == u);
+            if (interval == OPEN_INTERVAL)
+                CHECK(u > 0.0 && u < 1.0);
+            else if (interval == HALF_OPEN_INTERVAL)
+                CHECK(u >= 0.0 && u < 1.0);
+            else
+                CHECK(u >= 0.0 && u <= 1.0);
+        }
+    }
+}
+
+}
+
+int main()
+{
+    BasicRandGenerator<Xoshiro256RandEngine> generator;
+    generator.Reseed(1);
+    std::vector<unsigned long long> words64 = {0, 1, 0xFFFFFFFFULL, 1ULL << 32, 1ULL << 63,
+                                               ~0ULL, ~0ULL << 11, ~0ULL >> 1, 0x7FFULL};
+    for (int i = 0; i != 1000; ++i)
+        words64.push_back(generator.Variate());
+    std::vector<unsigned long long> words32;
+    for (unsigned long long word : words64)
+        words32.push_back(word & 0xFFFFFFFFULL);
+
+    for (UNIFORM_INTERVAL interval : {OPEN_INTERVAL, HALF_OPEN_INTERVAL, CLOSED_INTERVAL}) {
+        checkConversion(words32, 0, interval, RESOLUTION_32);
+        checkConversion(words64, 32, interval, RESOLUTION_32);
+        checkConversion(words64, 32, interval, RESOLUTION_53);
+    }
+
+    /// bounds of the intervals are reached only where they belong to them
+    CHECK(UniformConversion::FromWord(0, 32, HALF_OPEN_INTERVAL, RESOLUTION_53) == 0.0);
+    CHECK(UniformConversion::FromWord(0, 32, CLOSED_INTERVAL, RESOLUTION_53) == 0.0);
+    CHECK(UniformConversion::FromWord(~0ULL, 32, CLOSED_INTERVAL, RESOLUTION_53) == 1.0);
+    CHECK(UniformConversion::FromWord(~0ULL, 32, CLOSED_INTERVAL, RESOLUTION_32) == 1.0);
+    CHECK(UniformConversion::FromWord(0xFFFFFFFFULL, 0, CLOSED_INTERVAL, RESOLUTION_32) == 1.0);
+
+    return RandLibTest::result("UniformConversionTest");
+}
@@ -0,0 +1,74 @@
+#include "TestUtils.h"
+
+/// bounded integers are unbiased for wide and narrow engines
+
+namespace
+{
+
+/// engine with outputs from 0 to Range - 1
+template <unsigned long long Range>
+class NarrowRandEngine final : public RandEngine
+{
+    PCGRandEngine engine{};
+
+public:
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return Range - 1; }
+    void Reseed(unsigned long seed) { engine.Reseed(seed); }
+    void ReseedStream(unsigned long long rootSeed, unsigned long long streamId) { engine.ReseedStream(rootSeed, streamId); }
+    unsigned long long Next() { return engine.Next() % Range; }
+    void Fill(unsigned long long *output, size_t size)
+    {
+        for (size_t i = 0; i != size; ++i)
+            output[i] = Next();
+    }
+};
+
+void checkUniform(const UniformDiscreteRand &X, unsigned long seed)
+{
+    X.Reseed(seed);
+    std::vector<int> sample(100000);
+    X.Sample(sample);
+    CHECK(RandLibTest::fitsDiscrete(X, sample));
+    for (int &var : sample)
+        var = X.Variate();
+    CHECK(RandLibTest::fitsDiscrete(X, sample));
+}
+
+}
+
+int main()
+{
+    /// multiply-shift for 32- and 64-bit engines
+    checkUniform(UniformDiscreteRand(0, 2), 1);
+    checkUniform(UniformDiscreteRand(-5, 1000), 2);
+    UniformDiscreteRand wide(0, 1 << 30);
+    wide.SetEngine(RandGenerator(JLKiss64RandEngine()));
+    wide.Reseed(3);
+    double sum = 0;
+    for (int i = 0; i != 100000; ++i) {
+        int var = wide.Variate();
+        CHECK(var >= 0 && var <= (1 << 30));
+        sum += var;
+    }
+    /// relative standard deviation of the mean is below 0.002
+    CHECK(RandLibTest::isClose(sum / 100000, wide.Mean(), 0.01 * wide.Mean()));
+
+    /// rejection and modulo for engines with less than 32 bits: plain modulo of 10 values would give 0 with probability 0.4
+    UniformDiscreteRand X(0, 2), Y(1, 10);
+    X.SetEngine(RandGenerator(NarrowRandEngine<10>()));
+    checkUniform(X, 4);
+    Y.SetEngine(RandGenerator(NarrowRandEngine<65536>()));
+    checkUniform(Y, 5);
+
+    bool thrown = false;
+    try {
+        UniformDiscreteRand(0, 10).SetEngine(RandGenerator(NarrowRandEngine<10>()));
+    }
+    catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return RandLibTest::result("UniformDiscreteTest");
+}
@@ -0,0 +1,30 @@
+#include "TestUtils.h"
+
+/// rejection-inversion fits Zipf distribution, including huge numbers of elements
+
+namespace
+{
+
+void checkZipf(double exponent, int number, unsigned long seed)
+{
+    ZipfRand X(exponent, number);
+    X.Reseed(seed);
+    std::vector<int> sample(50000);
+    X.Sample(sample);
+    for (int var : sample)
+        CHECK(var >= 1 && var <= number);
+    /// values above 1000 form one cell
+    CHECK(RandLibTest::fitsDiscrete(X, sample, 1e-3, 1000));
+}
+
+}
+
+int main()
+{
+    checkZipf(1.5, 10, 1);
+    checkZipf(1.01, 1000, 2);
+    checkZipf(1.2, 100000, 3);
+    checkZipf(2.5, 1000000, 4);
+    checkZipf(1.1, 1000000000, 5);
+    return RandLibTest::result("ZipfTest");
+}